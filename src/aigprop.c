@@ -11,6 +11,7 @@
 #include "btorcore.h"
 #include "utils/btorhashint.h"
 #include "utils/btorhashptr.h"
+#include "utils/btorintheap.h"
 #include "utils/btorstack.h"
 #include "utils/btorutil.h"
 
@@ -60,14 +61,34 @@ btor_aigprop_get_assignment_aig (BtorAIGProp *aprop, BtorAIG *aig)
   if (btor_aig_is_false (aig)) return -1;
 
   id = btor_aig_get_id (BTOR_REAL_ADDR_AIG (aig));
-  assert (btor_hashint_map_get (aprop->model, id));
-  res = btor_hashint_map_get (aprop->model, id)->as_int;
+  if (aprop->assignment)
+  {
+    assert ((uint32_t) id < aprop->size);
+    res = aprop->assignment[id];
+  }
+  else
+  {
+    assert (btor_hashint_map_get (aprop->model, id));
+    res = btor_hashint_map_get (aprop->model, id)->as_int;
+  }
   res = BTOR_IS_INVERTED_AIG (aig) ? -res : res;
   return res;
 }
 
 /*------------------------------------------------------------------------*/
 
+/* Score of the AIG with (signed) id 'id', negative if not computed yet. */
+static inline double *
+get_score_aig (BtorAIGProp *aprop, int32_t id)
+{
+  assert (aprop);
+  assert (aprop->score);
+  assert (id);
+  assert ((uint32_t) (id < 0 ? -id : id) < aprop->size);
+
+  return &aprop->score[id < 0 ? 2 * (uint32_t) -id + 1 : 2 * (uint32_t) id];
+}
+
 /* score
  *
  * score (aigvar, A) = A (aigvar)
@@ -132,8 +153,8 @@ compute_score_aig (BtorAIGProp *aprop, BtorAIG *aig)
 #endif
 
   curid = btor_aig_get_id (aig);
-  if (btor_hashint_map_contains (aprop->score, curid))
-    return btor_hashint_map_get (aprop->score, curid)->as_dbl;
+  if (*get_score_aig (aprop, curid) >= 0.0)
+    return *get_score_aig (aprop, curid);
 
   mm  = aprop->amgr->btor->mm;
   res = 0.0;
@@ -150,7 +171,7 @@ compute_score_aig (BtorAIGProp *aprop, BtorAIG *aig)
     if (btor_aig_is_const (real_cur)) continue;
 
     curid = btor_aig_get_id (cur);
-    if (btor_hashint_map_contains (aprop->score, curid)) continue;
+    if (*get_score_aig (aprop, curid) >= 0.0) continue;
 
     d = btor_hashint_map_get (mark, real_cur->id);
     if (d && d->as_int == 1) continue;
@@ -183,8 +204,8 @@ compute_score_aig (BtorAIGProp *aprop, BtorAIG *aig)
                        real_cur->id,
                        a < 0 ? 0 : 1);
 #endif
-      assert (!btor_hashint_map_contains (aprop->score, curid));
-      assert (!btor_hashint_map_contains (aprop->score, -curid));
+      assert (*get_score_aig (aprop, curid) < 0.0);
+      assert (*get_score_aig (aprop, -curid) < 0.0);
 
       if (btor_aig_is_var (real_cur))
       {
@@ -199,8 +220,8 @@ compute_score_aig (BtorAIGProp *aprop, BtorAIG *aig)
                          BTOR_IS_INVERTED_AIG (cur) ? "" : "-",
                          real_cur->id,
                          res == 0.0 ? 1.0 : 0.0);
-        btor_hashint_map_add (aprop->score, curid)->as_dbl = res;
-        btor_hashint_map_add (aprop->score, -curid)->as_dbl =
+        *get_score_aig (aprop, curid) = res;
+        *get_score_aig (aprop, -curid) =
             res == 0.0 ? 1.0 : 0.0;
       }
       else
@@ -213,40 +234,40 @@ compute_score_aig (BtorAIGProp *aprop, BtorAIG *aig)
         rightid = btor_aig_get_id (right);
 
         assert (btor_aig_is_const (left)
-                || btor_hashint_map_contains (aprop->score, leftid));
+                || *get_score_aig (aprop, leftid) >= 0.0);
         assert (btor_aig_is_const (right)
-                || btor_hashint_map_contains (aprop->score, rightid));
+                || *get_score_aig (aprop, rightid) >= 0.0);
         assert (btor_aig_is_const (left)
-                || btor_hashint_map_contains (aprop->score, -leftid));
+                || *get_score_aig (aprop, -leftid) >= 0.0);
         assert (btor_aig_is_const (right)
-                || btor_hashint_map_contains (aprop->score, -rightid));
+                || *get_score_aig (aprop, -rightid) >= 0.0);
 
         sleft = btor_aig_is_const (left)
                     ? (btor_aig_is_true (left) ? 1.0 : 0.0)
-                    : btor_hashint_map_get (aprop->score, leftid)->as_dbl;
+                    : *get_score_aig (aprop, leftid);
         sright = btor_aig_is_const (right)
                      ? (btor_aig_is_true (right) ? 1.0 : 0.0)
-                     : btor_hashint_map_get (aprop->score, rightid)->as_dbl;
+                     : *get_score_aig (aprop, rightid);
         res = (sleft + sright) / 2.0;
         /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
            choose minimum (else it might again result in 1.0) */
         if (res == 1.0 && (sleft < 1.0 || sright < 1.0))
           res = sleft < sright ? sleft : sright;
         assert (res >= 0.0 && res <= 1.0);
-        btor_hashint_map_add (aprop->score, real_cur->id)->as_dbl = res;
+        *get_score_aig (aprop, real_cur->id) = res;
 #ifndef NDEBUG
         BTOR_AIGPROP_LOG_COMPUTE_SCORE_AIG (
             real_cur, left, right, sleft, sright, res);
 #endif
         sleft = btor_aig_is_const (left)
                     ? (btor_aig_is_true (left) ? 0.0 : 1.0)
-                    : btor_hashint_map_get (aprop->score, -leftid)->as_dbl;
+                    : *get_score_aig (aprop, -leftid);
         sright = btor_aig_is_const (right)
                      ? (btor_aig_is_true (right) ? 0.0 : 1.0)
-                     : btor_hashint_map_get (aprop->score, -rightid)->as_dbl;
+                     : *get_score_aig (aprop, -rightid);
         res = sleft > sright ? sleft : sright;
         assert (res >= 0.0 && res <= 1.0);
-        btor_hashint_map_add (aprop->score, -real_cur->id)->as_dbl = res;
+        *get_score_aig (aprop, -real_cur->id) = res;
 #ifndef NDEBUG
         BTOR_AIGPROP_LOG_COMPUTE_SCORE_AIG (BTOR_INVERT_AIG (real_cur),
                                             BTOR_INVERT_AIG (left),
@@ -256,16 +277,16 @@ compute_score_aig (BtorAIGProp *aprop, BtorAIG *aig)
                                             res);
 #endif
       }
-      assert (btor_hashint_map_contains (aprop->score, curid));
-      assert (btor_hashint_map_contains (aprop->score, -curid));
+      assert (*get_score_aig (aprop, curid) >= 0.0);
+      assert (*get_score_aig (aprop, -curid) >= 0.0);
     }
   }
 
   btor_hashint_map_delete (mark);
   BTOR_RELEASE_STACK (stack);
 
-  assert (btor_hashint_map_contains (aprop->score, btor_aig_get_id (aig)));
-  assert (btor_hashint_map_contains (aprop->score, -btor_aig_get_id (aig)));
+  assert (*get_score_aig (aprop, btor_aig_get_id (aig)) >= 0.0);
+  assert (*get_score_aig (aprop, -btor_aig_get_id (aig)) >= 0.0);
   return res;
 }
 
@@ -274,8 +295,9 @@ compute_scores (BtorAIGProp *aprop)
 {
   assert (aprop);
   assert (aprop->roots);
-  assert (aprop->model);
+  assert (aprop->assignment);
 
+  uint32_t i;
   BtorAIGPtrStack stack;
   BtorIntHashTable *cache;
   BtorAIG *cur, *real_cur, *left, *right;
@@ -289,7 +311,11 @@ compute_scores (BtorAIGProp *aprop)
   BTOR_INIT_STACK (mm, stack);
   cache = btor_hashint_table_new (mm);
 
-  if (!aprop->score) aprop->score = btor_hashint_map_new (mm);
+  if (!aprop->score)
+  {
+    BTOR_NEWN (mm, aprop->score, 2 * aprop->size);
+    for (i = 0; i < 2 * aprop->size; i++) aprop->score[i] = -1.0;
+  }
 
   /* collect roots */
   btor_iter_hashint_init (&it, aprop->roots);
@@ -304,8 +330,7 @@ compute_scores (BtorAIGProp *aprop)
     real_cur = BTOR_REAL_ADDR_AIG (cur);
 
     if (btor_aig_is_const (real_cur)) continue;
-    if (btor_hashint_map_contains (aprop->score, btor_aig_get_id (cur)))
-      continue;
+    if (*get_score_aig (aprop, btor_aig_get_id (cur)) >= 0.0) continue;
 
     if (!btor_hashint_table_contains (cache, real_cur->id))
     {
@@ -488,6 +513,87 @@ update_unsatroots_table (BtorAIGProp *aprop, BtorAIG *aig, int32_t assignment)
   }
 }
 
+static void
+queue_parents (BtorAIGProp *aprop,
+               BtorIntStack *queue,
+               BtorIntHashTable *queued,
+               BtorAIG *aig)
+{
+  assert (aprop);
+  assert (queue);
+  assert (queued);
+  assert (aig);
+  assert (BTOR_IS_REGULAR_AIG (aig));
+  assert (btor_hashint_map_contains (aprop->parents, aig->id));
+
+  uint32_t i;
+  int32_t id;
+  BtorIntStack *parents;
+
+  parents = btor_hashint_map_get (aprop->parents, aig->id)->as_ptr;
+  for (i = 0; i < BTOR_COUNT_STACK (*parents); i++)
+  {
+    id = BTOR_PEEK_STACK (*parents, i);
+    if (btor_hashint_table_contains (queued, id)) continue;
+    btor_hashint_table_add (queued, id);
+    btor_intheap_push (queue, id);
+  }
+}
+
+static bool
+update_score_aig (BtorAIGProp *aprop, BtorAIG *aig)
+{
+  assert (aprop);
+  assert (aprop->score);
+  assert (aig);
+  assert (BTOR_IS_REGULAR_AIG (aig));
+  assert (btor_aig_is_and (aig));
+  assert (*get_score_aig (aprop, aig->id) >= 0.0);
+  assert (*get_score_aig (aprop, -aig->id) >= 0.0);
+
+  int32_t leftid, rightid;
+  bool res;
+  double sleft, sright, s, *score;
+  BtorAIG *left, *right;
+
+  left    = btor_aig_get_left_child (aprop->amgr, aig);
+  right   = btor_aig_get_right_child (aprop->amgr, aig);
+  leftid  = btor_aig_get_id (left);
+  rightid = btor_aig_get_id (right);
+
+  sleft = btor_aig_is_const (left)
+              ? (btor_aig_is_true (left) ? 1.0 : 0.0)
+              : *get_score_aig (aprop, leftid);
+  sright = btor_aig_is_const (right)
+               ? (btor_aig_is_true (right) ? 1.0 : 0.0)
+               : *get_score_aig (aprop, rightid);
+  s = (sleft + sright) / 2.0;
+  /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
+     choose minimum (else it might again result in 1.0) */
+  if (s == 1.0 && (sleft < 1.0 || sright < 1.0))
+    s = sleft < sright ? sleft : sright;
+  assert (s >= 0.0 && s <= 1.0);
+  score  = get_score_aig (aprop, aig->id);
+  res    = *score != s;
+  *score = s;
+
+  sleft = btor_aig_is_const (left)
+              ? (btor_aig_is_true (left) ? 0.0 : 1.0)
+              : *get_score_aig (aprop, -leftid);
+  sright = btor_aig_is_const (right)
+               ? (btor_aig_is_true (right) ? 1.0 : 0.0)
+               : *get_score_aig (aprop, -rightid);
+  s = sleft > sright ? sleft : sright;
+  assert (s >= 0.0 && s <= 1.0);
+  score  = get_score_aig (aprop, -aig->id);
+  res    = res || *score != s;
+  *score = s;
+  return res;
+}
+
+/* Update the cone of 'aig' after flipping its assignment. AIGs are updated in
+ * ascending id order (ids are topologically ordered) and the parents of an
+ * AIG are only scheduled if its assignment (respectively score) changed. */
 static void
 update_cone (BtorAIGProp *aprop, BtorAIG *aig, int32_t assignment)
 {
@@ -497,13 +603,12 @@ update_cone (BtorAIGProp *aprop, BtorAIG *aig, int32_t assignment)
   assert (btor_aig_is_var (aig));
   assert (assignment == 1 || assignment == -1);
 
-  int32_t aleft, aright, ass, leftid, rightid;
+  int32_t aleft, aright, ass;
   uint32_t i;
-  double start, delta, sleft, sright, s;
-  BtorIntHashTable *cache;
-  BtorHashTableData *d;
-  BtorAIGPtrStack stack, cone;
-  BtorIntStack *parents;
+  double start, delta;
+  BtorIntHashTable *queued;
+  BtorAIGPtrStack updated;
+  BtorIntStack queue;
   BtorAIG *cur, *left, *right;
   BtorMemMgr *mm;
 
@@ -545,66 +650,46 @@ update_cone (BtorAIGProp *aprop, BtorAIG *aig, int32_t assignment)
   }
 #endif
 
-  /* reset cone ----------------------------------------------------------- */
-
-  BTOR_INIT_STACK (mm, cone);
-  BTOR_INIT_STACK (mm, stack);
-  cache = btor_hashint_table_new (mm);
-  BTOR_PUSH_STACK (stack, aig);
-  while (!BTOR_EMPTY_STACK (stack))
-  {
-    cur = BTOR_POP_STACK (stack);
-    assert (BTOR_IS_REGULAR_AIG (cur));
-    if (btor_hashint_table_contains (cache, cur->id)) continue;
-    btor_hashint_table_add (cache, cur->id);
-    if (cur != aig) BTOR_PUSH_STACK (cone, cur);
-    assert (btor_hashint_map_contains (aprop->parents, cur->id));
-    parents = btor_hashint_map_get (aprop->parents, cur->id)->as_ptr;
-    for (i = 0; i < BTOR_COUNT_STACK (*parents); i++)
-      BTOR_PUSH_STACK (
-          stack,
-          btor_aig_get_by_id (aprop->amgr, BTOR_PEEK_STACK (*parents, i)));
-  }
-  BTOR_RELEASE_STACK (stack);
-  btor_hashint_table_delete (cache);
+  /* update assignment and score of 'aig' --------------------------------- */
 
-  aprop->time.update_cone_reset += btor_util_time_stamp () - start;
+  BTOR_INIT_STACK (mm, updated);
+  BTOR_INIT_STACK (mm, queue);
+  queued = btor_hashint_table_new (mm);
 
-  /* update assignment and score of 'aig' --------------------------------- */
+  aprop->stats.updates += 1;
   /* update model */
-  d = btor_hashint_map_get (aprop->model, aig->id);
-  assert (d);
-  /* update unsatroots table */
-  if (d->as_int != assignment
-      && (btor_hashint_table_contains (aprop->roots, aig->id)
-          || btor_hashint_table_contains (aprop->roots, -aig->id)))
-    update_unsatroots_table (aprop, aig, assignment);
-  d->as_int = assignment;
+  assert (aprop->assignment[aig->id]);
+  if (aprop->assignment[aig->id] != assignment)
+  {
+    /* update unsatroots table */
+    if (btor_hashint_table_contains (aprop->roots, aig->id)
+        || btor_hashint_table_contains (aprop->roots, -aig->id))
+      update_unsatroots_table (aprop, aig, assignment);
+    aprop->assignment[aig->id] = assignment;
+    BTOR_PUSH_STACK (updated, aig);
+    queue_parents (aprop, &queue, queued, aig);
+  }
 
   /* update score */
   if (aprop->score)
   {
-    d         = btor_hashint_map_get (aprop->score, aig->id);
-    d->as_dbl = assignment < 0 ? 0.0 : 1.0;
-    d         = btor_hashint_map_get (aprop->score, -aig->id);
-    d->as_dbl = assignment < 0 ? 1.0 : 0.0;
+    *get_score_aig (aprop, aig->id)  = assignment < 0 ? 0.0 : 1.0;
+    *get_score_aig (aprop, -aig->id) = assignment < 0 ? 1.0 : 0.0;
   }
 
-  qsort (cone.start,
-         BTOR_COUNT_STACK (cone),
-         sizeof (BtorAIG *),
-         btor_compare_aig_by_id_qsort_asc);
+  aprop->time.update_cone_reset += btor_util_time_stamp () - start;
 
   /* update model of cone ------------------------------------------------- */
 
   delta = btor_util_time_stamp ();
 
-  for (i = 0; i < BTOR_COUNT_STACK (cone); i++)
+  while (!BTOR_EMPTY_STACK (queue))
   {
-    cur = BTOR_PEEK_STACK (cone, i);
+    cur = btor_aig_get_by_id (aprop->amgr, btor_intheap_pop (&queue));
     assert (BTOR_IS_REGULAR_AIG (cur));
     assert (btor_aig_is_and (cur));
-    assert (btor_hashint_map_contains (aprop->model, cur->id));
+    assert (aprop->assignment[cur->id]);
+    aprop->stats.updates += 1;
 
     left  = btor_aig_get_left_child (aprop->amgr, cur);
     right = btor_aig_get_right_child (aprop->amgr, cur);
@@ -613,65 +698,42 @@ update_cone (BtorAIGProp *aprop, BtorAIG *aig, int32_t assignment)
     aright = btor_aigprop_get_assignment_aig (aprop, right);
     assert (aright);
     ass = aleft < 0 || aright < 0 ? -1 : 1;
-    d   = btor_hashint_map_get (aprop->model, cur->id);
-    assert (d);
+    /* old assignment == new assignment, cut off */
+    if (aprop->assignment[cur->id] == ass) continue;
     /* update unsatroots table */
-    if (d->as_int != ass
-        && (btor_hashint_table_contains (aprop->roots, cur->id)
-            || btor_hashint_table_contains (aprop->roots, -cur->id)))
+    if (btor_hashint_table_contains (aprop->roots, cur->id)
+        || btor_hashint_table_contains (aprop->roots, -cur->id))
       update_unsatroots_table (aprop, cur, ass);
-    d->as_int = ass;
+    aprop->assignment[cur->id] = ass;
+    BTOR_PUSH_STACK (updated, cur);
+    queue_parents (aprop, &queue, queued, cur);
   }
 
   aprop->time.update_cone_model_gen += btor_util_time_stamp () - delta;
-  delta = btor_util_time_stamp ();
 
   /* update score of cone ------------------------------------------------- */
 
+  /* the score of an AIG only depends on the scores of its children, start
+   * from the parents of all AIGs with a changed assignment */
   if (aprop->score)
   {
     delta = btor_util_time_stamp ();
-    for (i = 0; i < BTOR_COUNT_STACK (cone); i++)
+    btor_hashint_table_delete (queued);
+    queued = btor_hashint_table_new (mm);
+    for (i = 0; i < BTOR_COUNT_STACK (updated); i++)
+      queue_parents (aprop, &queue, queued, BTOR_PEEK_STACK (updated, i));
+    while (!BTOR_EMPTY_STACK (queue))
     {
-      cur = BTOR_PEEK_STACK (cone, i);
-      assert (BTOR_IS_REGULAR_AIG (cur));
-      assert (btor_aig_is_and (cur));
-      assert (btor_hashint_map_contains (aprop->score, cur->id));
-      assert (btor_hashint_map_contains (aprop->score, -cur->id));
-
-      left    = btor_aig_get_left_child (aprop->amgr, cur);
-      right   = btor_aig_get_right_child (aprop->amgr, cur);
-      leftid  = btor_aig_get_id (left);
-      rightid = btor_aig_get_id (right);
-
-      sleft = btor_aig_is_const (left)
-                  ? (btor_aig_is_true (left) ? 1.0 : 0.0)
-                  : btor_hashint_map_get (aprop->score, leftid)->as_dbl;
-      sright = btor_aig_is_const (right)
-                   ? (btor_aig_is_true (right) ? 1.0 : 0.0)
-                   : btor_hashint_map_get (aprop->score, rightid)->as_dbl;
-      s = (sleft + sright) / 2.0;
-      /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
-         choose minimum (else it might again result in 1.0) */
-      if (s == 1.0 && (sleft < 1.0 || sright < 1.0))
-        s = sleft < sright ? sleft : sright;
-      assert (s >= 0.0 && s <= 1.0);
-      btor_hashint_map_get (aprop->score, cur->id)->as_dbl = s;
-
-      sleft = btor_aig_is_const (left)
-                  ? (btor_aig_is_true (left) ? 0.0 : 1.0)
-                  : btor_hashint_map_get (aprop->score, -leftid)->as_dbl;
-      sright = btor_aig_is_const (right)
-                   ? (btor_aig_is_true (right) ? 1.0 : 0.0)
-                   : btor_hashint_map_get (aprop->score, -rightid)->as_dbl;
-      s = sleft > sright ? sleft : sright;
-      assert (s >= 0.0 && s <= 1.0);
-      btor_hashint_map_get (aprop->score, -cur->id)->as_dbl = s;
+      cur = btor_aig_get_by_id (aprop->amgr, btor_intheap_pop (&queue));
+      if (update_score_aig (aprop, cur))
+        queue_parents (aprop, &queue, queued, cur);
     }
     aprop->time.update_cone_compute_score += btor_util_time_stamp () - delta;
   }
 
-  BTOR_RELEASE_STACK (cone);
+  btor_hashint_table_delete (queued);
+  BTOR_RELEASE_STACK (queue);
+  BTOR_RELEASE_STACK (updated);
 
 #ifndef NDEBUG
   btor_iter_hashint_init (&it, aprop->roots);
@@ -709,6 +771,24 @@ update_cone (BtorAIGProp *aprop, BtorAIG *aig, int32_t assignment)
 
 /*------------------------------------------------------------------------*/
 
+/* Bit-parallel assignment of 'aig', where bit i holds the value of 'aig'
+ * in lane i. 'lanes' is indexed by AIG id and holds the assignments of
+ * the regular AIGs. */
+static inline uint64_t
+get_lanes_aig (uint64_t *lanes, BtorAIG *aig)
+{
+  assert (lanes);
+
+  uint64_t res;
+
+  if (btor_aig_is_true (aig)) return ~(uint64_t) 0;
+  if (btor_aig_is_false (aig)) return 0;
+  res = lanes[BTOR_REAL_ADDR_AIG (aig)->id];
+  return BTOR_IS_INVERTED_AIG (aig) ? ~res : res;
+}
+
+/*------------------------------------------------------------------------*/
+
 static BtorAIG *
 select_root (BtorAIGProp *aprop, uint32_t nmoves)
 {
@@ -727,7 +807,6 @@ select_root (BtorAIGProp *aprop, uint32_t nmoves)
   {
     int32_t *selected;
     double value, max_value, score;
-    BtorHashTableData *d;
 
     max_value = 0.0;
     btor_iter_hashint_init (&it, aprop->unsatroots);
@@ -737,9 +816,7 @@ select_root (BtorAIGProp *aprop, uint32_t nmoves)
       cur      = btor_aig_get_by_id (aprop->amgr, btor_iter_hashint_next (&it));
       assert (btor_aigprop_get_assignment_aig (aprop, cur) != 1);
       assert (!btor_aig_is_const (cur));
-      d = btor_hashint_map_get (aprop->score, btor_aig_get_id (cur));
-      assert (d);
-      score = d->as_dbl;
+      score = *get_score_aig (aprop, btor_aig_get_id (cur));
       assert (score < 1.0);
       if (!res)
       {
@@ -786,9 +863,15 @@ select_root (BtorAIGProp *aprop, uint32_t nmoves)
   return res;
 }
 
+/* Select a move (input and its new assignment) on a path from 'root' down
+ * to an input. If 'lanes' is given, the path is selected w.r.t. the
+ * assignment in lane 'lane' of the bit-parallel assignment (see sat_lanes),
+ * else w.r.t. the current model. */
 static void
 select_move (BtorAIGProp *aprop,
              BtorAIG *root,
+             uint64_t *lanes,
+             uint32_t lane,
              BtorAIG **input,
              int32_t *assignment)
 {
@@ -801,7 +884,6 @@ select_move (BtorAIGProp *aprop,
   int32_t i, asscur, ass[2], assnew;
   uint32_t eidx;
   BtorAIG *cur, *real_cur, *c[2];
-  BtorHashTableData *d;
 
   *input      = 0;
   *assignment = 0;
@@ -840,12 +922,11 @@ select_move (BtorAIGProp *aprop,
          * else choose randomly */
         for (i = 0; i < 2; i++)
         {
-          assert (btor_hashint_map_get (aprop->model,
-                                        BTOR_REAL_ADDR_AIG (c[i])->id));
-          d = btor_hashint_map_get (aprop->model,
-                                    BTOR_REAL_ADDR_AIG (c[i])->id);
-          assert (d);
-          ass[i] = BTOR_IS_INVERTED_AIG (c[i]) ? -d->as_int : d->as_int;
+          if (lanes)
+            ass[i] = (get_lanes_aig (lanes, c[i]) >> lane) & 1 ? 1 : -1;
+          else
+            ass[i] = btor_aigprop_get_assignment_aig (aprop, c[i]);
+          assert (ass[i]);
         }
         if (ass[0] == -1 && ass[1] == 1)
           eidx = 0;
@@ -883,7 +964,7 @@ move (BtorAIGProp *aprop, uint32_t nmoves)
   assert (aprop);
   assert (aprop->roots);
   assert (aprop->unsatroots);
-  assert (aprop->model);
+  assert (aprop->assignment);
 
   int32_t assignment;
   BtorAIG *root, *input;
@@ -891,7 +972,7 @@ move (BtorAIGProp *aprop, uint32_t nmoves)
   /* roots contain false AIG -> unsat */
   if (!(root = select_root (aprop, nmoves))) return 0;
 
-  select_move (aprop, root, &input, &assignment);
+  select_move (aprop, root, 0, 0, &input, &assignment);
 
   BTOR_AIGPROPLOG (1, "");
   BTOR_AIGPROPLOG (1, "*** move");
@@ -912,6 +993,206 @@ move (BtorAIGProp *aprop, uint32_t nmoves)
 
 /*------------------------------------------------------------------------*/
 
+/* Initial assignment of all AIGs in 'cone' (in ascending id order), all
+ * inputs are initialized with false. */
+static void
+init_assignment (BtorAIGProp *aprop, BtorIntStack *cone)
+{
+  assert (aprop);
+  assert (aprop->assignment);
+  assert (cone);
+
+  int32_t aleft, aright;
+  uint32_t i;
+  BtorAIG *cur;
+
+  for (i = 0; i < BTOR_COUNT_STACK (*cone); i++)
+  {
+    cur = btor_aig_get_by_id (aprop->amgr, BTOR_PEEK_STACK (*cone, i));
+    assert (BTOR_IS_REGULAR_AIG (cur));
+    if (btor_aig_is_var (cur))
+    {
+      aprop->assignment[cur->id] = -1;
+    }
+    else
+    {
+      assert (btor_aig_is_and (cur));
+      aleft = btor_aigprop_get_assignment_aig (
+          aprop, btor_aig_get_left_child (aprop->amgr, cur));
+      aright = btor_aigprop_get_assignment_aig (
+          aprop, btor_aig_get_right_child (aprop->amgr, cur));
+      assert (aleft && aright);
+      aprop->assignment[cur->id] = aleft < 0 || aright < 0 ? -1 : 1;
+    }
+  }
+}
+
+/* Random initial assignment of all inputs for all lanes, lane 0 is
+ * initialized with false (as in the sequential mode) on the first start. */
+static void
+init_lanes (BtorAIGProp *aprop,
+            uint64_t *lanes,
+            BtorIntStack *cone,
+            bool first)
+{
+  assert (aprop);
+  assert (lanes);
+  assert (cone);
+
+  uint32_t i;
+  uint64_t r;
+  BtorAIG *cur;
+
+  for (i = 0; i < BTOR_COUNT_STACK (*cone); i++)
+  {
+    cur = btor_aig_get_by_id (aprop->amgr, BTOR_PEEK_STACK (*cone, i));
+    assert (BTOR_IS_REGULAR_AIG (cur));
+    if (btor_aig_is_var (cur))
+    {
+      r = ((uint64_t) btor_rng_rand (&aprop->rng) << 32)
+          | btor_rng_rand (&aprop->rng);
+      lanes[cur->id] = first ? r & ~(uint64_t) 1 : r;
+    }
+    else
+    {
+      assert (btor_aig_is_and (cur));
+      lanes[cur->id] =
+          get_lanes_aig (lanes, btor_aig_get_left_child (aprop->amgr, cur))
+          & get_lanes_aig (lanes, btor_aig_get_right_child (aprop->amgr, cur));
+    }
+    aprop->stats.updates += 1;
+  }
+}
+
+/* Bit-parallel variant of the move loop: BTOR_AIGPROP_NLANES independent
+ * walkers advance in lockstep. Each AIG holds one assignment per lane packed
+ * into a machine word, and the cone of all inputs flipped in a step is
+ * updated with bitwise AND in ascending id order (once for all lanes).
+ * Roots are selected randomly per lane (no bandit scheme). The first lane
+ * that satisfies all roots is copied into the assignment. */
+static int32_t
+sat_lanes (BtorAIGProp *aprop, BtorIntStack *cone)
+{
+  assert (aprop);
+  assert (aprop->roots);
+  assert (aprop->parents);
+  assert (aprop->assignment);
+  assert (cone);
+
+  bool first;
+  int32_t j, max_steps, rootid, id, sat_result, assignment;
+  uint32_t i, lane, r, nroots;
+  uint64_t *lanes, sat, mask;
+  BtorIntHashTableIterator it;
+  BtorIntHashTable *queued;
+  BtorIntStack queue;
+  BtorAIGPtrStack roots;
+  BtorAIG *root, *cur, *input;
+  BtorMemMgr *mm;
+
+  mm         = aprop->amgr->btor->mm;
+  sat_result = BTOR_AIGPROP_UNKNOWN;
+  first      = true;
+
+  BTOR_INIT_STACK (mm, roots);
+  BTOR_INIT_STACK (mm, queue);
+
+  btor_iter_hashint_init (&it, aprop->roots);
+  while (btor_iter_hashint_has_next (&it))
+  {
+    rootid = btor_iter_hashint_next (&it);
+    root   = btor_aig_get_by_id (aprop->amgr, rootid);
+    if (btor_aig_is_true (root)) continue;
+    if (btor_aig_is_false (root)) goto UNSAT;
+    if (btor_hashint_table_contains (aprop->roots, -rootid)) goto UNSAT;
+    BTOR_PUSH_STACK (roots, root);
+  }
+  nroots = BTOR_COUNT_STACK (roots);
+
+  BTOR_CNEWN (mm, lanes, aprop->size);
+
+  for (;;)
+  {
+    init_lanes (aprop, lanes, cone, first);
+    first = false;
+
+    for (j = 0, max_steps = BTOR_AIGPROP_MAXSTEPS (aprop->stats.restarts + 1);
+         ;
+         j++)
+    {
+      sat = ~(uint64_t) 0;
+      for (i = 0; i < nroots; i++)
+        sat &= get_lanes_aig (lanes, BTOR_PEEK_STACK (roots, i));
+      if (sat) goto SAT;
+
+      if (aprop->use_restarts && j >= max_steps) break;
+
+      /* select and perform one move per lane */
+      queued = btor_hashint_table_new (mm);
+      for (lane = 0; lane < BTOR_AIGPROP_NLANES; lane++)
+      {
+        mask = (uint64_t) 1 << lane;
+        r    = btor_rng_pick_rand (&aprop->rng, 0, nroots - 1);
+        for (i = 0;; i++)
+        {
+          root = BTOR_PEEK_STACK (roots, (r + i) % nroots);
+          if (!(get_lanes_aig (lanes, root) & mask)) break;
+        }
+        select_move (aprop, root, lanes, lane, &input, &assignment);
+        if (!input) continue;
+        assert (btor_aig_is_var (input));
+        aprop->stats.moves += 1;
+        if (((lanes[input->id] & mask) != 0) == (assignment == 1)) continue;
+        lanes[input->id] ^= mask;
+        aprop->stats.updates += 1;
+        queue_parents (aprop, &queue, queued, input);
+      }
+
+      /* update cone of all flipped inputs */
+      while (!BTOR_EMPTY_STACK (queue))
+      {
+        id  = btor_intheap_pop (&queue);
+        cur = btor_aig_get_by_id (aprop->amgr, id);
+        assert (btor_aig_is_and (cur));
+        aprop->stats.updates += 1;
+        mask =
+            get_lanes_aig (lanes, btor_aig_get_left_child (aprop->amgr, cur))
+            & get_lanes_aig (lanes,
+                             btor_aig_get_right_child (aprop->amgr, cur));
+        /* old assignment == new assignment, cut off */
+        if (lanes[id] == mask) continue;
+        lanes[id] = mask;
+        queue_parents (aprop, &queue, queued, cur);
+      }
+      btor_hashint_table_delete (queued);
+    }
+
+    aprop->stats.restarts += 1;
+  }
+
+SAT:
+  sat_result = BTOR_AIGPROP_SAT;
+  for (lane = 0; !((sat >> lane) & 1); lane++)
+    ;
+  BTOR_AIGPROPLOG (1, "");
+  BTOR_AIGPROPLOG (1, "*** lane %u satisfies all roots", lane);
+  for (i = 0; i < BTOR_COUNT_STACK (*cone); i++)
+  {
+    id                    = BTOR_PEEK_STACK (*cone, i);
+    aprop->assignment[id] = (lanes[id] >> lane) & 1 ? 1 : -1;
+  }
+  BTOR_DELETEN (mm, lanes, aprop->size);
+  goto DONE;
+UNSAT:
+  sat_result = BTOR_AIGPROP_UNSAT;
+DONE:
+  BTOR_RELEASE_STACK (queue);
+  BTOR_RELEASE_STACK (roots);
+  return sat_result;
+}
+
+/*------------------------------------------------------------------------*/
+
 // TODO termination callback?
 int32_t
 btor_aigprop_sat (BtorAIGProp *aprop, BtorIntHashTable *roots)
@@ -921,13 +1202,13 @@ btor_aigprop_sat (BtorAIGProp *aprop, BtorIntHashTable *roots)
 
   double start;
   int32_t i, j, max_steps, sat_result, rootid, childid;
-  uint32_t nmoves;
+  uint32_t k, nmoves;
   BtorMemMgr *mm;
   BtorIntHashTable *cache;
   BtorIntHashTableIterator it;
   BtorHashTableData *d;
   BtorAIGPtrStack stack;
-  BtorIntStack *childparents;
+  BtorIntStack *childparents, cone, heap;
   BtorAIG *root, *cur, *child;
 
   start      = btor_util_time_stamp ();
@@ -995,8 +1276,28 @@ btor_aigprop_sat (BtorAIGProp *aprop, BtorIntHashTable *roots)
   btor_hashint_map_delete (cache);
   BTOR_RELEASE_STACK (stack);
 
-  /* generate initial model, all inputs are initialized with false */
-  btor_aigprop_generate_model (aprop, true);
+  /* AIGs in the cone of the roots in ascending id order */
+  BTOR_INIT_STACK (mm, cone);
+  BTOR_INIT_STACK (mm, heap);
+  btor_iter_hashint_init (&it, aprop->parents);
+  while (btor_iter_hashint_has_next (&it))
+    btor_intheap_push (&heap, btor_iter_hashint_next (&it));
+  while (!BTOR_EMPTY_STACK (heap))
+    BTOR_PUSH_STACK (cone, btor_intheap_pop (&heap));
+  BTOR_RELEASE_STACK (heap);
+
+  /* assignments (and scores) are kept in dense arrays during search */
+  aprop->size = BTOR_COUNT_STACK (aprop->amgr->id2aig);
+  BTOR_CNEWN (mm, aprop->assignment, aprop->size);
+
+  if (aprop->use_lanes)
+  {
+    if (sat_lanes (aprop, &cone) == BTOR_AIGPROP_SAT) goto SAT;
+    goto UNSAT;
+  }
+
+  /* generate initial assignment, all inputs are initialized with false */
+  init_assignment (aprop, &cone);
 
   for (;;)
   {
@@ -1032,8 +1333,8 @@ btor_aigprop_sat (BtorAIGProp *aprop, BtorIntHashTable *roots)
     }
 
     /* restart */
-    btor_aigprop_generate_model (aprop, true);
-    btor_hashint_map_delete (aprop->score);
+    init_assignment (aprop, &cone);
+    BTOR_DELETEN (mm, aprop->score, 2 * aprop->size);
     aprop->score = 0;
     btor_hashint_map_delete (aprop->unsatroots);
     aprop->unsatroots = 0;
@@ -1041,10 +1342,21 @@ btor_aigprop_sat (BtorAIGProp *aprop, BtorIntHashTable *roots)
   }
 SAT:
   sat_result = BTOR_AIGPROP_SAT;
+  /* generate model from the current assignment */
+  btor_aigprop_init_model (aprop);
+  for (k = 0; k < BTOR_COUNT_STACK (cone); k++)
+  {
+    rootid = BTOR_PEEK_STACK (cone, k);
+    btor_hashint_map_add (aprop->model, rootid)->as_int =
+        aprop->assignment[rootid];
+  }
   goto DONE;
 UNSAT:
   sat_result = BTOR_AIGPROP_UNSAT;
 DONE:
+  BTOR_RELEASE_STACK (cone);
+  BTOR_DELETEN (mm, aprop->assignment, aprop->size);
+  aprop->assignment = 0;
   btor_iter_hashint_init (&it, aprop->parents);
   while (btor_iter_hashint_has_next (&it))
   {
@@ -1058,7 +1370,7 @@ DONE:
   if (aprop->unsatroots) btor_hashint_map_delete (aprop->unsatroots);
   aprop->unsatroots = 0;
   aprop->roots      = 0;
-  if (aprop->score) btor_hashint_map_delete (aprop->score);
+  if (aprop->score) BTOR_DELETEN (mm, aprop->score, 2 * aprop->size);
   aprop->score = 0;
 
   aprop->time.sat += btor_util_time_stamp () - start;
@@ -1083,8 +1395,18 @@ btor_aigprop_clone_aigprop (BtorAIGMgr *clone, BtorAIGProp *aprop)
   res->amgr = clone;
   res->unsatroots =
       btor_hashint_map_clone (mm, aprop->unsatroots, btor_clone_data_as_int, 0);
-  res->score =
-      btor_hashint_map_clone (mm, aprop->score, btor_clone_data_as_dbl, 0);
+  if (aprop->assignment)
+  {
+    BTOR_NEWN (mm, res->assignment, aprop->size);
+    memcpy (res->assignment,
+            aprop->assignment,
+            aprop->size * sizeof (*aprop->assignment));
+  }
+  if (aprop->score)
+  {
+    BTOR_NEWN (mm, res->score, 2 * aprop->size);
+    memcpy (res->score, aprop->score, 2 * aprop->size * sizeof (*aprop->score));
+  }
   res->model =
       btor_hashint_map_clone (mm, aprop->model, btor_clone_data_as_int, 0);
   return res;
@@ -1095,7 +1417,8 @@ btor_aigprop_new_aigprop (BtorAIGMgr *amgr,
                           uint32_t loglevel,
                           uint32_t seed,
                           uint32_t use_restarts,
-                          uint32_t use_bandit)
+                          uint32_t use_bandit,
+                          uint32_t use_lanes)
 {
   assert (amgr);
 
@@ -1108,6 +1431,7 @@ btor_aigprop_new_aigprop (BtorAIGMgr *amgr,
   res->seed         = seed;
   res->use_restarts = use_restarts;
   res->use_bandit   = use_bandit;
+  res->use_lanes    = use_lanes;
 
   return res;
 }
@@ -1119,7 +1443,10 @@ btor_aigprop_delete_aigprop (BtorAIGProp *aprop)
 
   btor_rng_delete (&aprop->rng);
   if (aprop->unsatroots) btor_hashint_map_delete (aprop->unsatroots);
-  if (aprop->score) btor_hashint_map_delete (aprop->score);
+  if (aprop->assignment)
+    BTOR_DELETEN (aprop->amgr->btor->mm, aprop->assignment, aprop->size);
+  if (aprop->score)
+    BTOR_DELETEN (aprop->amgr->btor->mm, aprop->score, 2 * aprop->size);
   if (aprop->model) btor_hashint_map_delete (aprop->model);
   BTOR_DELETE (aprop->amgr->btor->mm, aprop);
 }
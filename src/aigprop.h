@@ -17,26 +17,35 @@
 #define BTOR_AIGPROP_SAT 10
 #define BTOR_AIGPROP_UNSAT 20
 
+#define BTOR_AIGPROP_NLANES 64
+
 struct BtorAIGProp
 {
   BtorAIGMgr *amgr;
   BtorIntHashTable *roots;
   BtorIntHashTable *unsatroots;
-  BtorIntHashTable *score;
   BtorIntHashTable *model;
   BtorIntHashTable *parents;
 
+  /* Dense arrays indexed by AIG id, only allocated during search. The model
+   * is generated from 'assignment' if the search is successful. */
+  uint32_t size;
+  int8_t *assignment;
+  double *score; /* score of aig (2 * id) and its negation (2 * id + 1) */
+
   BtorRNG rng;
 
   uint32_t loglevel;
   uint32_t seed;
   uint32_t use_restarts;
   uint32_t use_bandit;
+  uint32_t use_lanes; /* BTOR_AIGPROP_NLANES walkers in lockstep */
 
   struct
   {
     uint32_t moves;
     uint32_t restarts;
+    uint64_t updates;
   } stats;
 
   struct
@@ -55,7 +64,8 @@ BtorAIGProp *btor_aigprop_new_aigprop (BtorAIGMgr *amgr,
                                        uint32_t loglevel,
                                        uint32_t seed,
                                        uint32_t use_restarts,
-                                       uint32_t use_bandit);
+                                       uint32_t use_bandit,
+                                       uint32_t use_lanes);
 
 BtorAIGProp *btor_aigprop_clone_aigprop (BtorAIGMgr *clone, BtorAIGProp *aprop);
 void btor_aigprop_delete_aigprop (BtorAIGProp *aprop);
@@ -94,6 +94,9 @@ cdef extern from "boolector.h":
     void boolector_fixate_assumptions (Btor * btor) \
       except +raise_py_error
 
+    void boolector_freeze_out (Btor * btor, BoolectorNode * node) \
+      except +raise_py_error
+
     void boolector_reset_assumptions (Btor * btor) \
       except +raise_py_error
 
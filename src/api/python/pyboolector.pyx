@@ -883,6 +883,20 @@ cdef class Boolector:
         """
         btorapi.boolector_fixate_assumptions(self._c_btor)
 
+    def Freeze_out(self, BoolectorNode n):
+        """ Freeze_out(n)
+
+            Declare that input ``n`` does not occur in any future assertion
+            or assumption.
+
+            In incremental mode, unconstrained optimization only considers
+            inputs that were declared this way.
+
+            :param n: Bit-vector variable or uninterpreted function.
+            :type n:  :class:`~pyboolector.BoolectorNode`
+        """
+        btorapi.boolector_freeze_out(self._c_btor, n._c_node)
+
     def Reset_assumptions(self):
         """ Reset_assumptions()
 
@@ -261,6 +261,13 @@ boolector_new (void)
 
   btor = btor_new ();
   if ((trname = getenv ("BTORAPITRACE"))) btor_trapi_open_trace (btor, trname);
+  if ((trname = getenv ("BTORLODTRACE")))
+  {
+    btor->lod_trace = fopen (trname, "w");
+    BTOR_ABORT (!btor->lod_trace,
+                "failed to open lemmas on demand trace file '%s'",
+                trname);
+  }
   BTOR_TRAPI ("");
   BTOR_TRAPI_RETURN_PTR (btor);
   return btor;
@@ -295,6 +302,7 @@ boolector_delete (Btor *btor)
     fclose (btor->apitrace);
   else if (btor->close_apitrace == 2)
     pclose (btor->apitrace);
+  if (btor->lod_trace) fclose (btor->lod_trace);
 #ifndef NDEBUG
   if (btor->clone) boolector_delete (btor->clone);
 #endif
@@ -419,11 +427,16 @@ boolector_push (Btor *btor, uint32_t level)
   if (level == 0) return;
 
   uint32_t i;
+  BtorSortId sort;
+
+  sort = btor_sort_bool (btor);
   for (i = 0; i < level; i++)
   {
     BTOR_PUSH_STACK (btor->assertions_trail,
                      BTOR_COUNT_STACK (btor->assertions));
+    BTOR_PUSH_STACK (btor->scope_acts, btor_exp_var (btor, sort, 0));
   }
+  btor_sort_release (btor, sort);
   btor->num_push_pop++;
 }
 
@@ -445,7 +458,13 @@ boolector_pop (Btor *btor, uint32_t level)
   BtorNode *cur;
 
   for (i = 0, pos = 0; i < level; i++)
+  {
     pos = BTOR_POP_STACK (btor->assertions_trail);
+    /* permanently disable assertions of popped context level */
+    cur = BTOR_POP_STACK (btor->scope_acts);
+    btor_assert_exp (btor, btor_node_invert (cur));
+    btor_node_release (btor, cur);
+  }
 
   while (BTOR_COUNT_STACK (btor->assertions) > pos)
   {
@@ -477,13 +496,18 @@ boolector_assert (Btor *btor, BoolectorNode *node)
   BTOR_ABORT (btor_node_real_addr (exp)->parameterized,
               "assertion must not be parameterized");
 
-  /* all assertions at a context level > 0 are internally handled as
-   * assumptions. */
+  /* all assertions at a context level > 0 are asserted relative to the
+   * activation literal of the current context level, which is assumed on
+   * every check-sat call until the context level is popped. */
   if (BTOR_COUNT_STACK (btor->assertions_trail) > 0)
   {
     int32_t id = btor_node_get_id (exp);
     if (!btor_hashint_table_contains (btor->assertions_cache, id))
     {
+      BtorNode *imp =
+          btor_exp_implies (btor, BTOR_TOP_STACK (btor->scope_acts), exp);
+      btor_assert_exp (btor, imp);
+      btor_node_release (btor, imp);
       BTOR_PUSH_STACK (btor->assertions, btor_node_copy (btor, exp));
       btor_hashint_table_add (btor->assertions_cache, id);
     }
@@ -607,6 +631,28 @@ boolector_fixate_assumptions (Btor *btor)
 #endif
 }
 
+void
+boolector_freeze_out (Btor *btor, BoolectorNode *node)
+{
+  BtorNode *exp;
+
+  exp = BTOR_IMPORT_BOOLECTOR_NODE (node);
+  BTOR_ABORT_ARG_NULL (btor);
+  BTOR_TRAPI_UNFUN (exp);
+  BTOR_ABORT_ARG_NULL (exp);
+  BTOR_ABORT_REFS_NOT_POS (exp);
+  BTOR_ABORT_BTOR_MISMATCH (btor, exp);
+  BTOR_ABORT (!btor_opt_get (btor, BTOR_OPT_INCREMENTAL),
+              "incremental usage has not been enabled");
+  BTOR_ABORT (!btor_node_is_bv_var (exp) && !btor_node_is_uf (exp),
+              "'exp' must be a bit-vector variable or an uninterpreted "
+              "function");
+  btor_freeze_out_exp (btor, exp);
+#ifndef NDEBUG
+  BTOR_CHKCLONE_NORES (freeze_out, BTOR_CLONED_EXP (exp));
+#endif
+}
+
 void
 boolector_reset_assumptions (Btor *btor)
 {
@@ -756,18 +802,12 @@ boolector_set_opt (Btor *btor, BtorOption opt, uint32_t val)
       BTOR_ABORT (btor->btor_sat_btor_called > 0,
                   "enabling/disabling incremental usage must be done "
                   "before calling 'boolector_sat'");
-      BTOR_ABORT (btor_opt_get (btor, BTOR_OPT_UCOPT),
-                  "incremental solving cannot be enabled "
-                  "if unconstrained optimization is enabled");
     }
     else if (opt == BTOR_OPT_UCOPT)
     {
       BTOR_ABORT (btor_opt_get (btor, BTOR_OPT_MODEL_GEN),
                   "Unconstrained optimization cannot be enabled "
                   "if model generation is enabled");
-      BTOR_ABORT (btor_opt_get (btor, BTOR_OPT_INCREMENTAL),
-                  "Unconstrained optimization cannot be enabled "
-                  "in incremental mode");
     }
     else if (opt == BTOR_OPT_FUN_DUAL_PROP)
     {
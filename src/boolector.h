@@ -304,6 +304,22 @@ BoolectorNode **boolector_get_failed_assumptions (Btor *btor);
 */
 void boolector_fixate_assumptions (Btor *btor);
 
+/*!
+  Declare that input ``node`` does not occur in any future assertion or
+  assumption.
+
+  In incremental mode, unconstrained optimization only considers inputs that
+  were declared this way. Using ``node`` in assertions or assumptions after
+  this call leads to undefined behavior.
+
+  :param btor: Boolector instance.
+  :param node: Bit-vector variable or uninterpreted function.
+
+  .. seealso::
+    boolector_set_opt, BTOR_OPT_UCOPT
+*/
+void boolector_freeze_out (Btor *btor, BoolectorNode *node);
+
 /*!
   Resets all added assumptions.
 
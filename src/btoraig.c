@@ -1471,10 +1471,12 @@ btor_aig_get_assignment (BtorAIGMgr *amgr, BtorAIG *aig)
   if (aig == BTOR_AIG_TRUE) return 1;
   if (aig == BTOR_AIG_FALSE) return -1;
 
-  /* Note: If an AIG is not yet encoded to SAT or if the SAT solver returns
+  /* Note: If an AIG is not yet encoded to SAT, if the last SAT call did not
+   * produce a model (e.g., it hit its limit), or if the SAT solver returns
    * undefined for a variable, we implicitly initialize it with false (-1). */
   int32_t val = -1;
-  if (BTOR_REAL_ADDR_AIG (aig)->cnf_id > 0)
+  if (BTOR_REAL_ADDR_AIG (aig)->cnf_id > 0
+      && amgr->smgr->last_result == BTOR_RESULT_SAT)
   {
     val = btor_sat_deref (amgr->smgr, BTOR_REAL_ADDR_AIG (aig)->cnf_id);
     if (val == 0)
@@ -1165,6 +1165,10 @@ chkclone_slv (Btor *btor, Btor *clone)
     BTOR_CHKCLONE_SLV_STATE (slv, cslv, flip_cond_const_prob);
     BTOR_CHKCLONE_SLV_STATE (slv, cslv, flip_cond_const_prob_delta);
     BTOR_CHKCLONE_SLV_STATE (slv, cslv, nflip_cond_const);
+    BTOR_CHKCLONE_SLV_STATE (slv, cslv, adaptive.cur);
+    assert (!memcmp (slv->adaptive.nselected,
+                     cslv->adaptive.nselected,
+                     sizeof (slv->adaptive.nselected)));
 
     BTOR_CHKCLONE_SLV_STATS (slv, cslv, restarts);
     BTOR_CHKCLONE_SLV_STATS (slv, cslv, moves);
@@ -1212,13 +1216,21 @@ chkclone_slv (Btor *btor, Btor *clone)
         slv->aprop->unsatroots, cslv->aprop->unsatroots, cmp_data_as_int);
     chkclone_int_hash_map (
         slv->aprop->model, cslv->aprop->model, cmp_data_as_int);
-    chkclone_int_hash_map (
-        slv->aprop->score, cslv->aprop->score, cmp_data_as_dbl);
+    BTOR_CHKCLONE_SLV_STATE (slv->aprop, cslv->aprop, size);
+    assert (!slv->aprop->assignment
+            || !memcmp (slv->aprop->assignment,
+                        cslv->aprop->assignment,
+                        slv->aprop->size * sizeof (*slv->aprop->assignment)));
+    assert (!slv->aprop->score
+            || !memcmp (slv->aprop->score,
+                        cslv->aprop->score,
+                        2 * slv->aprop->size * sizeof (*slv->aprop->score)));
 
     BTOR_CHKCLONE_SLV_STATE (slv->aprop, cslv->aprop, loglevel);
     BTOR_CHKCLONE_SLV_STATE (slv->aprop, cslv->aprop, seed);
     BTOR_CHKCLONE_SLV_STATE (slv->aprop, cslv->aprop, use_restarts);
     BTOR_CHKCLONE_SLV_STATE (slv->aprop, cslv->aprop, use_bandit);
+    BTOR_CHKCLONE_SLV_STATE (slv->aprop, cslv->aprop, use_lanes);
 
     BTOR_CHKCLONE_SLV_STATS (slv, cslv, moves);
     BTOR_CHKCLONE_SLV_STATS (slv, cslv, restarts);
@@ -1211,6 +1211,10 @@ clone_aux_btor (Btor *btor,
   assert ((allocated += MEM_INT_HASH_TABLE (btor->assertions_cache))
           == clone->mm->allocated);
 
+  clone->frozen_out = btor_hashint_table_clone (clone->mm, btor->frozen_out);
+  assert ((allocated += MEM_INT_HASH_TABLE (btor->frozen_out))
+          == clone->mm->allocated);
+
   btor_clone_node_ptr_stack (
       mm, &btor->assertions, &clone->assertions, emap, false);
   assert (
@@ -1226,6 +1230,12 @@ clone_aux_btor (Btor *btor,
            BTOR_SIZE_STACK (btor->assertions_trail) * sizeof (uint32_t))
           == clone->mm->allocated);
 
+  btor_clone_node_ptr_stack (
+      mm, &btor->scope_acts, &clone->scope_acts, emap, false);
+  assert (
+      (allocated += BTOR_SIZE_STACK (btor->scope_acts) * sizeof (BtorNode *))
+      == clone->mm->allocated);
+
   if (btor->bv_model)
   {
     clone->bv_model = btor_model_clone_bv (clone, btor->bv_model, false);
@@ -1454,6 +1464,7 @@ clone_aux_btor (Btor *btor,
       assert (BTOR_COUNT_STACK (slv->stats.lemmas_size)
               == BTOR_COUNT_STACK (cslv->stats.lemmas_size));
       allocated += BTOR_SIZE_STACK (slv->stats.lemmas_size) * sizeof (uint32_t);
+      allocated += BTOR_SIZE_STACK (slv->lgc.lemmas) * sizeof (BtorFunLemma);
     }
     else if (clone->slv->kind == BTOR_SLS_SOLVER_KIND)
     {
@@ -1522,12 +1533,14 @@ clone_aux_btor (Btor *btor,
       {
         assert (cslv->aprop);
         CHKCLONE_MEM_PTR_HASH_TABLE (slv->aprop->roots, cslv->aprop->roots);
-        CHKCLONE_MEM_PTR_HASH_TABLE (slv->aprop->score, cslv->aprop->score);
         CHKCLONE_MEM_PTR_HASH_TABLE (slv->aprop->model, cslv->aprop->model);
         allocated += sizeof (BtorAIGProp)
                      + MEM_PTR_HASH_TABLE (cslv->aprop->roots)
-                     + MEM_PTR_HASH_TABLE (cslv->aprop->score)
                      + MEM_PTR_HASH_TABLE (cslv->aprop->model);
+        if (cslv->aprop->assignment)
+          allocated += cslv->aprop->size * sizeof (*cslv->aprop->assignment);
+        if (cslv->aprop->score)
+          allocated += 2 * cslv->aprop->size * sizeof (*cslv->aprop->score);
       }
 
       allocated += sizeof (BtorAIGPropSolver);
@@ -1542,6 +1555,7 @@ clone_aux_btor (Btor *btor,
   clone->clone = NULL;
 #endif
   clone->close_apitrace = 0;
+  clone->lod_trace      = 0;
 
   if (exp_map)
     *exp_map = emap;
@@ -488,6 +488,22 @@ btor_print_stats (Btor *btor)
             1,
             "%5d extracted skeleton constraints",
             btor->stats.skeleton_constraints);
+  BTOR_MSG (btor->msg,
+            1,
+            "%5d simplifications (%d skipped, unchanged formula)",
+            btor->stats.simplify.calls,
+            btor->stats.simplify.skipped);
+  BTOR_MSG (btor->msg,
+            1,
+            "%5lld new constraints, %lld new assumptions simplified",
+            btor->stats.simplify.constraints,
+            btor->stats.simplify.assumptions);
+#ifndef BTOR_DO_NOT_PROCESS_SKELETON
+  BTOR_MSG (btor->msg,
+            1,
+            "%5d skeleton preprocessing runs skipped (no new constraints)",
+            btor->stats.simplify.skel_skipped);
+#endif
   BTOR_MSG (
       btor->msg, 1, "%5d and normalizations", btor->stats.ands_normalized);
   BTOR_MSG (
@@ -765,6 +781,8 @@ btor_new (void)
 
   BTOR_INIT_STACK (mm, btor->assertions);
   BTOR_INIT_STACK (mm, btor->assertions_trail);
+  BTOR_INIT_STACK (mm, btor->scope_acts);
+  btor->frozen_out       = btor_hashint_table_new (mm);
   btor->assertions_cache = btor_hashint_table_new (mm);
 
 #ifndef NDEBUG
@@ -941,6 +959,10 @@ btor_delete (Btor *btor)
     btor_node_release (btor, BTOR_PEEK_STACK (btor->assertions, i));
   BTOR_RELEASE_STACK (btor->assertions);
   BTOR_RELEASE_STACK (btor->assertions_trail);
+  for (i = 0; i < BTOR_COUNT_STACK (btor->scope_acts); i++)
+    btor_node_release (btor, BTOR_PEEK_STACK (btor->scope_acts, i));
+  BTOR_RELEASE_STACK (btor->scope_acts);
+  btor_hashint_table_delete (btor->frozen_out);
   btor_hashint_table_delete (btor->assertions_cache);
 
   btor_model_delete (btor);
@@ -1183,6 +1205,7 @@ btor_insert_unsynthesized_constraint (Btor *btor, BtorNode *exp)
     (void) btor_hashptr_table_add (uc, btor_node_copy (btor, exp));
     btor_node_real_addr (exp)->constraint = 1;
     btor->stats.constraints.unsynthesized++;
+    btor->simp_delta.constraints++;
     BTORLOG (
         1, "add unsynthesized constraint: %s", btor_util_node2string (exp));
   }
@@ -1852,6 +1875,9 @@ btor_assume_exp (Btor *btor, BtorNode *exp)
   {
     (void) btor_hashptr_table_add (btor->assumptions,
                                    btor_node_copy (btor, exp));
+    /* assumptions on inputs (e.g., activation literals of context levels)
+     * do not introduce new terms to preprocess */
+    if (!btor_node_is_bv_var (exp)) btor->simp_delta.assumptions++;
   }
 }
 
@@ -2008,6 +2034,32 @@ btor_failed_exp (Btor *btor, BtorNode *exp)
   return res;
 }
 
+void
+btor_freeze_out_exp (Btor *btor, BtorNode *exp)
+{
+  assert (btor);
+  assert (btor_opt_get (btor, BTOR_OPT_INCREMENTAL));
+  assert (exp);
+  assert (btor_node_is_bv_var (exp) || btor_node_is_uf (exp));
+
+  int32_t id;
+
+  BTORLOG (2, "freeze out: %s", btor_util_node2string (exp));
+  id = btor_node_real_addr (exp)->id;
+  if (!btor_hashint_table_contains (btor->frozen_out, id))
+    btor_hashint_table_add (btor->frozen_out, id);
+}
+
+static bool
+is_scope_act (Btor *btor, BtorNode *exp)
+{
+  size_t i;
+  for (i = 0; i < BTOR_COUNT_STACK (btor->scope_acts); i++)
+    if (btor_simplify_exp (btor, BTOR_PEEK_STACK (btor->scope_acts, i)) == exp)
+      return true;
+  return false;
+}
+
 void
 btor_fixate_assumptions (Btor *btor)
 {
@@ -2019,8 +2071,12 @@ btor_fixate_assumptions (Btor *btor)
   BTOR_INIT_STACK (btor->mm, stack);
   btor_iter_hashptr_init (&it, btor->assumptions);
   while (btor_iter_hashptr_has_next (&it))
-    BTOR_PUSH_STACK (stack,
-                     btor_node_copy (btor, btor_iter_hashptr_next (&it)));
+  {
+    exp = btor_iter_hashptr_next (&it);
+    /* activation literals of context levels are disabled on pop */
+    if (is_scope_act (btor, exp)) continue;
+    BTOR_PUSH_STACK (stack, btor_node_copy (btor, exp));
+  }
   for (i = 0; i < BTOR_COUNT_STACK (stack); i++)
   {
     exp = BTOR_PEEK_STACK (stack, i);
@@ -2890,17 +2946,18 @@ btor_check_sat (Btor *btor, int32_t lod_limit, int32_t sat_limit)
 
   if (btor->valid_assignments == 1) btor_reset_incremental_usage (btor);
 
-  /* 'btor->assertions' contains all assertions that were asserted in context
-   * levels > 0 (boolector_push). We assume all these assertions on every
-   * btor_check_sat call since these assumptions are valid until the
-   * corresponding context is popped. */
-  if (BTOR_COUNT_STACK (btor->assertions) > 0)
+  /* Assertions in context levels > 0 (boolector_push) are asserted relative
+   * to the activation literal of their context level. We assume the
+   * activation literals of all open context levels on every btor_check_sat
+   * call. */
+  if (BTOR_COUNT_STACK (btor->scope_acts) > 0)
   {
-    assert (BTOR_COUNT_STACK (btor->assertions_trail) > 0);
+    assert (BTOR_COUNT_STACK (btor->assertions_trail)
+            == BTOR_COUNT_STACK (btor->scope_acts));
     uint32_t i;
-    for (i = 0; i < BTOR_COUNT_STACK (btor->assertions); i++)
+    for (i = 0; i < BTOR_COUNT_STACK (btor->scope_acts); i++)
     {
-      btor_assume_exp (btor, BTOR_PEEK_STACK (btor->assertions, i));
+      btor_assume_exp (btor, BTOR_PEEK_STACK (btor->scope_acts, i));
     }
   }
 
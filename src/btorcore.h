@@ -123,6 +123,15 @@ struct Btor
 
   uint32_t rec_rw_calls; /* calls for recursive rewriting */
   uint32_t valid_assignments;
+
+  /* number of constraints and assumptions added since the last call to
+   * btor_simplify, 'simplified' is false if btor_simplify was not called yet */
+  struct
+  {
+    bool simplified;
+    uint32_t constraints;
+    uint32_t assumptions;
+  } simp_delta;
   BtorRwCache *rw_cache;
 
   int32_t vis_idx; /* file index for visualizing expressions */
@@ -154,6 +163,12 @@ struct Btor
   BtorIntHashTable *assertions_cache;
   /* saves the number of assertions on each push */
   BtorUIntStack assertions_trail;
+  /* ids of inputs that do not occur in future assertions and assumptions
+   * (unconstrained candidates in incremental mode) */
+  BtorIntHashTable *frozen_out;
+  /* activation literal of each context level, assertions at a context
+   * level 'l' are asserted as 'scope_acts[l - 1] -> assertion' */
+  BtorNodePtrStack scope_acts;
   /* Number of push/pop calls (used for unique symbol prefixes) */
   uint32_t num_push_pop;
 
@@ -166,6 +181,8 @@ struct Btor
   FILE *apitrace;
   int8_t close_apitrace;
 
+  FILE *lod_trace; /* JSON lines trace of lemmas on demand (BTORLODTRACE) */
+
   BtorOpt *options;
   BtorPtrHashTable *str2opt;
 
@@ -187,6 +204,14 @@ struct Btor
     uint32_t gaussian_eliminations; /* number of gaussian eliminations */
     uint32_t eliminated_slices;     /* number of eliminated slices */
     uint32_t skeleton_constraints;  /* number of skeleton constraints */
+    struct
+    {
+      uint32_t calls;             /* number of btor_simplify calls */
+      uint32_t skipped;           /* calls on unchanged formula */
+      uint32_t skel_skipped;      /* skeleton runs skipped (no new constr.) */
+      uint_least64_t constraints; /* new constraints processed */
+      uint_least64_t assumptions; /* new assumptions processed */
+    } simplify;
     uint32_t adds_normalized;       /* number of add chains normalizations */
     uint32_t ands_normalized;       /* number of and chains normalizations */
     uint32_t muls_normalized;       /* number of mul chains normalizations */
@@ -284,6 +309,10 @@ void btor_fixate_assumptions (Btor *btor);
 /* Resets assumptions */
 void btor_reset_assumptions (Btor *btor);
 
+/* Declares that input 'exp' does not occur in future assertions and
+ * assumptions. */
+void btor_freeze_out_exp (Btor *btor, BtorNode *exp);
+
 /* Solves instance, but with lemmas on demand limit 'lod_limit' and conflict
  * limit for the underlying SAT solver 'sat_limit'. */
 int32_t btor_check_sat (Btor *btor, int32_t lod_limit, int32_t sat_limit);
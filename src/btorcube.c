@@ -0,0 +1,499 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2007-2021 by the authors listed in the AUTHORS file.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "btorcube.h"
+
+#include "btorclone.h"
+#include "btorcore.h"
+#include "btorexp.h"
+#include "btorlog.h"
+#include "btormodel.h"
+#include "btoropt.h"
+#include "btorsat.h"
+#include "utils/btorhashint.h"
+#include "utils/btorhashptr.h"
+#include "utils/btorstack.h"
+#include "utils/btorutil.h"
+
+#ifdef BTOR_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
+/*------------------------------------------------------------------------*/
+
+/* Upper bound for the (tree) size estimates of the cone of a node. */
+#define BTOR_CUBE_MAX_SIZE (1 << 20)
+
+/* A split variable, either a 1-bit condition of an if-then-else (bit = 0) or
+ * bit 'bit' of a bit-vector variable. */
+struct BtorCubeSplit
+{
+  int32_t id;
+  uint32_t bit;
+  uint64_t score;
+  uint64_t pruned[2]; /* size of pruned cones for value 0 and 1 */
+};
+typedef struct BtorCubeSplit BtorCubeSplit;
+
+BTOR_DECLARE_STACK (BtorCubeSplit, BtorCubeSplit);
+
+typedef struct BtorCubeContext BtorCubeContext;
+
+struct BtorCubeWorker
+{
+  BtorCubeContext *ctx;
+  Btor *clone;
+  uint32_t solved; /* number of cubes solved by this worker */
+};
+typedef struct BtorCubeWorker BtorCubeWorker;
+
+struct BtorCubeContext
+{
+  Btor *btor;
+  BtorCubeSplit *splits;
+  uint32_t num_splits;
+  uint32_t num_cubes;
+  uint32_t next_cube;  /* next cube to solve */
+  uint32_t num_unsat;  /* number of unsatisfiable cubes */
+  bool done;           /* result determined or terminated */
+  BtorSolverResult result;
+  BtorCubeWorker *winner; /* worker that found a satisfiable cube */
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_t mutex;
+#endif
+};
+
+/*------------------------------------------------------------------------*/
+
+static void
+lock (BtorCubeContext *ctx)
+{
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_lock (&ctx->mutex);
+#else
+  (void) ctx;
+#endif
+}
+
+static void
+unlock (BtorCubeContext *ctx)
+{
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_unlock (&ctx->mutex);
+#else
+  (void) ctx;
+#endif
+}
+
+/*------------------------------------------------------------------------*/
+
+static int32_t
+cmp_split (const void *p, const void *q)
+{
+  const BtorCubeSplit *a = p, *b = q;
+  if (a->score > b->score) return -1;
+  if (a->score < b->score) return 1;
+  if (a->id != b->id) return a->id - b->id;
+  return (int32_t) b->bit - (int32_t) a->bit;
+}
+
+static BtorCubeSplit *
+get_cond_split (BtorCubeSplitStack *splits,
+                BtorIntHashTable *cache,
+                BtorNode *cond)
+{
+  BtorHashTableData *d;
+  BtorCubeSplit split;
+
+  if ((d = btor_hashint_map_get (cache, cond->id)))
+    return splits->start + d->as_int;
+
+  BTOR_CLR (&split);
+  split.id = cond->id;
+  btor_hashint_map_add (cache, cond->id)->as_int = BTOR_COUNT_STACK (*splits);
+  BTOR_PUSH_STACK (*splits, split);
+  return splits->top - 1;
+}
+
+/* Select split variables ranked by a lookahead score. For a condition c, we
+ * estimate the size of the cones that are pruned when c is fixed to 0 (then
+ * branches of all if-then-else nodes over c) and to 1 (else branches), and
+ * score c with the product of both (as in lookahead solvers, which prefer
+ * variables that reduce the formula on both sides). For bit-vector variables
+ * we use the number of parents, halved for every further bit of the same
+ * variable (most significant bits first). */
+static uint32_t
+select_splits (Btor *btor, uint32_t depth, BtorCubeSplit **res)
+{
+  assert (btor);
+  assert (depth > 0);
+  assert (res);
+
+  uint32_t i, n, width;
+  int32_t size;
+  uint64_t score;
+  BtorNode *cur, *real_cond, *vars_cur;
+  BtorMemMgr *mm;
+  BtorNodePtrStack visit, vars;
+  BtorIntHashTable *sizes, *cache;
+  BtorHashTableData *d;
+  BtorPtrHashTableIterator it;
+  BtorCubeSplitStack splits;
+  BtorCubeSplit *split, vsplit;
+
+  mm = btor->mm;
+  BTOR_INIT_STACK (mm, visit);
+  BTOR_INIT_STACK (mm, vars);
+  BTOR_INIT_STACK (mm, splits);
+  sizes = btor_hashint_map_new (mm);
+  cache = btor_hashint_map_new (mm);
+
+  btor_iter_hashptr_init (&it, btor->synthesized_constraints);
+  btor_iter_hashptr_queue (&it, btor->unsynthesized_constraints);
+  btor_iter_hashptr_queue (&it, btor->embedded_constraints);
+  btor_iter_hashptr_queue (&it, btor->assumptions);
+  while (btor_iter_hashptr_has_next (&it))
+    BTOR_PUSH_STACK (visit, btor_iter_hashptr_next (&it));
+
+  while (!BTOR_EMPTY_STACK (visit))
+  {
+    cur = btor_node_real_addr (BTOR_POP_STACK (visit));
+    d   = btor_hashint_map_get (sizes, cur->id);
+
+    if (!d)
+    {
+      btor_hashint_map_add (sizes, cur->id)->as_int = 0;
+      BTOR_PUSH_STACK (visit, cur);
+      for (i = 0; i < cur->arity; i++) BTOR_PUSH_STACK (visit, cur->e[i]);
+    }
+    else if (d->as_int == 0)
+    {
+      size = 1;
+      for (i = 0; i < cur->arity; i++)
+      {
+        size += btor_hashint_map_get (sizes, btor_node_real_addr (cur->e[i])->id)
+                    ->as_int;
+        if (size > BTOR_CUBE_MAX_SIZE) size = BTOR_CUBE_MAX_SIZE;
+      }
+      d->as_int = size;
+
+      if (btor_node_is_bv_var (cur))
+      {
+        BTOR_PUSH_STACK (vars, cur);
+      }
+      else if (btor_node_is_bv_cond (cur))
+      {
+        real_cond = btor_node_real_addr (cur->e[0]);
+        if (btor_node_is_bv_const (real_cond)) continue;
+        split = get_cond_split (&splits, cache, real_cond);
+        /* cond = 0 prunes then branch, cond = 1 prunes else branch */
+        i = btor_node_is_inverted (cur->e[0]) ? 1 : 0;
+        split->pruned[i] +=
+            btor_hashint_map_get (sizes, btor_node_real_addr (cur->e[1])->id)
+                ->as_int;
+        split->pruned[1 - i] +=
+            btor_hashint_map_get (sizes, btor_node_real_addr (cur->e[2])->id)
+                ->as_int;
+      }
+    }
+  }
+
+  for (i = 0; i < BTOR_COUNT_STACK (splits); i++)
+  {
+    split        = splits.start + i;
+    split->score = (split->pruned[0] + 1) * (split->pruned[1] + 1);
+  }
+
+  for (i = 0; i < BTOR_COUNT_STACK (vars); i++)
+  {
+    vars_cur = BTOR_PEEK_STACK (vars, i);
+    /* already a split candidate as condition */
+    if (btor_hashint_map_contains (cache, vars_cur->id)) continue;
+    width    = btor_node_bv_get_width (btor, vars_cur);
+    score    = ((uint64_t) vars_cur->parents + 1) * (vars_cur->parents + 1);
+    for (n = 0; n < depth && n < width && score; n++, score /= 2)
+    {
+      BTOR_CLR (&vsplit);
+      vsplit.id    = vars_cur->id;
+      vsplit.bit   = width - 1 - n;
+      vsplit.score = score;
+      BTOR_PUSH_STACK (splits, vsplit);
+    }
+  }
+
+  n = BTOR_COUNT_STACK (splits);
+  qsort (splits.start, n, sizeof (BtorCubeSplit), cmp_split);
+  if (n > depth) n = depth;
+
+  *res = 0;
+  if (n > 0)
+  {
+    BTOR_NEWN (mm, *res, n);
+    memcpy (*res, splits.start, n * sizeof (BtorCubeSplit));
+  }
+
+  btor_hashint_map_delete (cache);
+  btor_hashint_map_delete (sizes);
+  BTOR_RELEASE_STACK (splits);
+  BTOR_RELEASE_STACK (vars);
+  BTOR_RELEASE_STACK (visit);
+  return n;
+}
+
+/*------------------------------------------------------------------------*/
+
+static int32_t
+terminate_cube (void *state)
+{
+  BtorCubeContext *ctx = state;
+  return ctx->done;
+}
+
+static Btor *
+new_cube_clone (BtorCubeContext *ctx)
+{
+  uint32_t i;
+  Btor *clone;
+  BtorNode *cur;
+  BtorNodePtrStack assumptions;
+  BtorPtrHashTableIterator it;
+
+  clone = btor_clone_formula (ctx->btor);
+  btor_set_term (clone, terminate_cube, ctx);
+  btor_opt_set (clone, BTOR_OPT_CUBE_THREADS, 0);
+  btor_opt_set (clone, BTOR_OPT_UCOPT, 0);
+  btor_opt_set (clone, BTOR_OPT_MODEL_GEN, 1);
+  /* cubes are solved under assumptions */
+  if (!btor_opt_get (clone, BTOR_OPT_INCREMENTAL))
+    btor_opt_set (clone, BTOR_OPT_INCREMENTAL, 1);
+  btor_opt_set (clone, BTOR_OPT_CHK_MODEL, 0);
+  btor_opt_set (clone, BTOR_OPT_CHK_UNCONSTRAINED, 0);
+  btor_opt_set (clone, BTOR_OPT_CHK_FAILED_ASSUMPTIONS, 0);
+  btor_opt_set (clone, BTOR_OPT_VERBOSITY, 0);
+
+  /* assumptions of the current SAT call are fixed for all cubes */
+  BTOR_INIT_STACK (clone->mm, assumptions);
+  btor_iter_hashptr_init (&it, clone->assumptions);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    cur = btor_iter_hashptr_next (&it);
+    BTOR_PUSH_STACK (assumptions, btor_node_copy (clone, cur));
+  }
+  btor_reset_assumptions (clone);
+  for (i = 0; i < BTOR_COUNT_STACK (assumptions); i++)
+  {
+    cur = BTOR_PEEK_STACK (assumptions, i);
+    btor_assert_exp (clone, cur);
+    btor_node_release (clone, cur);
+  }
+  BTOR_RELEASE_STACK (assumptions);
+  return clone;
+}
+
+/* Create literal for split variable 'split' with value 'val' in 'clone'. */
+static BtorNode *
+mk_split_lit (Btor *clone, BtorCubeSplit *split, bool val)
+{
+  BtorNode *exp, *res;
+
+  exp = btor_node_get_by_id (clone, split->id);
+  assert (exp);
+  if (btor_node_bv_get_width (clone, exp) == 1)
+    exp = btor_node_copy (clone, exp);
+  else
+    exp = btor_exp_bv_slice (clone, exp, split->bit, split->bit);
+  res = val ? btor_node_copy (clone, exp) : btor_exp_bv_not (clone, exp);
+  btor_node_release (clone, exp);
+  return res;
+}
+
+static void *
+solve_cubes (void *state)
+{
+  bool failed;
+  uint32_t i, cube;
+  BtorSolverResult res;
+  BtorCubeWorker *worker;
+  BtorCubeContext *ctx;
+  Btor *clone;
+  BtorNodePtrStack lits;
+
+  worker = state;
+  ctx    = worker->ctx;
+  clone  = worker->clone;
+  BTOR_INIT_STACK (clone->mm, lits);
+
+  while (true)
+  {
+    lock (ctx);
+    if (ctx->done || ctx->next_cube >= ctx->num_cubes)
+    {
+      unlock (ctx);
+      break;
+    }
+    cube = ctx->next_cube++;
+    unlock (ctx);
+
+    for (i = 0; i < ctx->num_splits; i++)
+    {
+      BTOR_PUSH_STACK (
+          lits, mk_split_lit (clone, ctx->splits + i, (cube >> i) & 1));
+      btor_assume_exp (clone, BTOR_TOP_STACK (lits));
+    }
+
+    res = btor_check_sat (clone, -1, -1);
+    worker->solved += 1;
+
+    failed = false;
+    if (res == BTOR_RESULT_UNSAT)
+    {
+      for (i = 0; !failed && i < BTOR_COUNT_STACK (lits); i++)
+        failed = btor_failed_exp (clone, BTOR_PEEK_STACK (lits, i));
+    }
+    while (!BTOR_EMPTY_STACK (lits))
+      btor_node_release (clone, BTOR_POP_STACK (lits));
+
+    lock (ctx);
+    if (res == BTOR_RESULT_SAT && !ctx->done)
+    {
+      ctx->done   = true;
+      ctx->result = BTOR_RESULT_SAT;
+      ctx->winner = worker;
+    }
+    else if (res == BTOR_RESULT_UNSAT && !ctx->done)
+    {
+      ctx->num_unsat += 1;
+      /* formula is unsat independent of the cube */
+      if (!failed || ctx->num_unsat == ctx->num_cubes)
+      {
+        ctx->done   = true;
+        ctx->result = BTOR_RESULT_UNSAT;
+      }
+    }
+    unlock (ctx);
+    if (res == BTOR_RESULT_UNKNOWN) break;
+  }
+
+  BTOR_RELEASE_STACK (lits);
+  return 0;
+}
+
+/* Transfer assignments of all bit-vector variables from the clone of the
+ * worker that found a satisfiable cube to 'btor'. Since the clone has the same
+ * node ids, the remaining model values are computed on model generation. */
+static void
+transfer_model (Btor *btor, Btor *clone)
+{
+  BtorNode *var, *cvar;
+  BtorPtrHashTableIterator it;
+  const BtorBitVector *bv;
+
+  if (btor->bv_model) btor_model_delete_bv (btor, &btor->bv_model);
+  btor_model_init_bv (btor, &btor->bv_model);
+
+  btor_iter_hashptr_init (&it, btor->bv_vars);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    var  = btor_iter_hashptr_next (&it);
+    cvar = btor_node_get_by_id (clone, var->id);
+    assert (cvar);
+    bv = btor_model_get_bv (clone, cvar);
+    btor_model_add_to_bv (btor, btor->bv_model, var, bv);
+  }
+}
+
+BtorSolverResult
+btor_cube_and_conquer (Btor *btor)
+{
+  assert (btor);
+  assert (btor->ufs->count == 0);
+  assert (btor->feqs->count == 0);
+  assert (btor->lambdas->count == 0);
+  assert (btor->quantifiers->count == 0);
+
+  uint32_t i, num_threads, solved;
+  double start;
+  BtorCubeContext ctx;
+  BtorCubeWorker *workers;
+  BtorMemMgr *mm;
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_t *threads;
+#endif
+
+  start = btor_util_time_stamp ();
+  mm    = btor->mm;
+
+  BTOR_CLR (&ctx);
+  ctx.btor   = btor;
+  ctx.result = BTOR_RESULT_UNKNOWN;
+  ctx.num_splits =
+      select_splits (btor, btor_opt_get (btor, BTOR_OPT_CUBE_DEPTH), &ctx.splits);
+  if (!ctx.num_splits) return BTOR_RESULT_UNKNOWN;
+  ctx.num_cubes = 1u << ctx.num_splits;
+
+  num_threads = btor_opt_get (btor, BTOR_OPT_CUBE_THREADS);
+#ifndef BTOR_HAVE_PTHREADS
+  num_threads = 1;
+#endif
+  if (num_threads > ctx.num_cubes) num_threads = ctx.num_cubes;
+
+  BTOR_MSG (btor->msg,
+            1,
+            "cube-and-conquer: %u split variables, %u cubes, %u threads",
+            ctx.num_splits,
+            ctx.num_cubes,
+            num_threads);
+
+  /* clones are created upfront since cloning accesses 'btor' */
+  BTOR_CNEWN (mm, workers, num_threads);
+  for (i = 0; i < num_threads; i++)
+  {
+    workers[i].ctx   = &ctx;
+    workers[i].clone = new_cube_clone (&ctx);
+  }
+
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_mutex_init (&ctx.mutex, 0);
+  BTOR_NEWN (mm, threads, num_threads);
+  for (i = 0; i < num_threads; i++)
+    pthread_create (&threads[i], 0, solve_cubes, &workers[i]);
+  for (i = 0; i < num_threads; i++) pthread_join (threads[i], 0);
+  BTOR_DELETEN (mm, threads, num_threads);
+  pthread_mutex_destroy (&ctx.mutex);
+#else
+  solve_cubes (&workers[0]);
+#endif
+
+  /* UNSAT with stale SAT solver state would yield wrong failed assumptions,
+   * let the regular engine determine the result in this case */
+  if (ctx.result == BTOR_RESULT_UNSAT && btor->assumptions->count
+      && btor_sat_is_initialized (btor_get_sat_mgr (btor)))
+    ctx.result = BTOR_RESULT_UNKNOWN;
+
+  if (ctx.result == BTOR_RESULT_SAT)
+    transfer_model (btor, ctx.winner->clone);
+
+  solved = 0;
+  for (i = 0; i < num_threads; i++)
+  {
+    solved += workers[i].solved;
+    btor_delete (workers[i].clone);
+  }
+  BTOR_DELETEN (mm, workers, num_threads);
+  BTOR_DELETEN (mm, ctx.splits, ctx.num_splits);
+
+  BTOR_MSG (btor->msg,
+            1,
+            "cube-and-conquer: %s after %u cubes in %.2f seconds",
+            ctx.result == BTOR_RESULT_SAT
+                ? "sat"
+                : (ctx.result == BTOR_RESULT_UNSAT ? "unsat" : "unknown"),
+            solved,
+            btor_util_time_stamp () - start);
+  return ctx.result;
+}
@@ -0,0 +1,26 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2007-2021 by the authors listed in the AUTHORS file.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifndef BTORCUBE_H_INCLUDED
+#define BTORCUBE_H_INCLUDED
+
+#include "btortypes.h"
+
+/* Cube-and-conquer for QF_BV formulas.
+ *
+ * Selects BTOR_OPT_CUBE_DEPTH split variables (conditions of if-then-else
+ * nodes and bits of bit-vector variables), splits the formula into
+ * 2^BTOR_OPT_CUBE_DEPTH cubes and solves them in BTOR_OPT_CUBE_THREADS
+ * clones of 'btor' concurrently. Stops as soon as a satisfiable cube is found,
+ * in which case the model of the clone is transferred to 'btor'.
+ *
+ * Returns BTOR_RESULT_UNKNOWN if the formula could not be decided this way.
+ */
+BtorSolverResult btor_cube_and_conquer (Btor *btor);
+
+#endif
@@ -13,6 +13,7 @@
 #include "btormodel.h"
 #include "btornode.h"
 #include "btorslsutils.h"
+#include "utils/btorintheap.h"
 #include "utils/btornodeiter.h"
 #include "utils/btorutil.h"
 
@@ -65,9 +66,134 @@ update_roots_table (Btor *btor,
   }
 }
 
+static BtorBitVector *
+get_child_value (Btor *btor, BtorIntHashTable *bv_model, BtorNode *exp)
+{
+  assert (btor);
+  assert (bv_model);
+  assert (exp);
+
+  BtorHashTableData *d;
+
+  if (btor_node_is_bv_const (exp))
+  {
+    return btor_node_is_inverted (exp)
+               ? btor_bv_copy (btor->mm, btor_node_bv_const_get_invbits (exp))
+               : btor_bv_copy (btor->mm, btor_node_bv_const_get_bits (exp));
+  }
+  d = btor_hashint_map_get (bv_model, btor_node_real_addr (exp)->id);
+  /* Note: generate model enabled branch for ite (and does not
+   * generate model for nodes in the branch, hence !b may happen */
+  if (!d)
+    return btor_model_recursively_compute_assignment (
+        btor, bv_model, btor->fun_model, exp);
+  return btor_node_is_inverted (exp) ? btor_bv_not (btor->mm, d->as_ptr)
+                                     : btor_bv_copy (btor->mm, d->as_ptr);
+}
+
+static BtorBitVector *
+compute_value (BtorMemMgr *mm, BtorNode *exp, BtorBitVector *e[])
+{
+  assert (mm);
+  assert (exp);
+  assert (btor_node_is_regular (exp));
+
+  BtorBitVector *res;
+
+  switch (exp->kind)
+  {
+    case BTOR_BV_ADD_NODE: res = btor_bv_add (mm, e[0], e[1]); break;
+    case BTOR_BV_AND_NODE: res = btor_bv_and (mm, e[0], e[1]); break;
+    case BTOR_BV_EQ_NODE: res = btor_bv_eq (mm, e[0], e[1]); break;
+    case BTOR_BV_ULT_NODE: res = btor_bv_ult (mm, e[0], e[1]); break;
+    case BTOR_BV_SLL_NODE: res = btor_bv_sll (mm, e[0], e[1]); break;
+    case BTOR_BV_SRL_NODE: res = btor_bv_srl (mm, e[0], e[1]); break;
+    case BTOR_BV_MUL_NODE: res = btor_bv_mul (mm, e[0], e[1]); break;
+    case BTOR_BV_UDIV_NODE: res = btor_bv_udiv (mm, e[0], e[1]); break;
+    case BTOR_BV_UREM_NODE: res = btor_bv_urem (mm, e[0], e[1]); break;
+    case BTOR_BV_CONCAT_NODE: res = btor_bv_concat (mm, e[0], e[1]); break;
+    case BTOR_BV_SLICE_NODE:
+      res = btor_bv_slice (mm,
+                           e[0],
+                           btor_node_bv_slice_get_upper (exp),
+                           btor_node_bv_slice_get_lower (exp));
+      break;
+    default:
+      assert (btor_node_is_cond (exp));
+      res = btor_bv_is_true (e[0]) ? btor_bv_copy (mm, e[1])
+                                   : btor_bv_copy (mm, e[2]);
+  }
+  return res;
+}
+
+static void
+queue_parents (BtorIntStack *queue, BtorIntHashTable *queued, BtorNode *exp)
+{
+  assert (queue);
+  assert (queued);
+  assert (exp);
+  assert (btor_node_is_regular (exp));
+
+  BtorNode *parent;
+  BtorNodeIterator it;
+
+  btor_iter_parent_init (&it, exp);
+  while (btor_iter_parent_has_next (&it))
+  {
+    parent = btor_iter_parent_next (&it);
+    assert (btor_node_is_regular (parent));
+    if (btor_hashint_table_contains (queued, parent->id)) continue;
+    btor_hashint_table_add (queued, parent->id);
+    btor_intheap_push (queue, parent->id);
+  }
+}
+
+static bool
+update_score_node (Btor *btor,
+                   BtorIntHashTable *bv_model,
+                   BtorIntHashTable *score,
+                   BtorNode *exp)
+{
+  assert (btor);
+  assert (bv_model);
+  assert (score);
+  assert (exp);
+  assert (btor_node_is_regular (exp));
+
+  double s;
+  bool res;
+  BtorHashTableData *d;
+
+  if (btor_node_bv_get_width (btor, exp) != 1) return false;
+
+  if (!(d = btor_hashint_map_get (score, exp->id)))
+  {
+    /* not reachable from the roots */
+    assert (!btor_hashint_map_contains (score, -exp->id));
+    return false;
+  }
+  s = btor_slsutils_compute_score_node (
+      btor, bv_model, btor->fun_model, score, exp);
+  res       = s != d->as_dbl;
+  d->as_dbl = s;
+
+  d = btor_hashint_map_get (score, -exp->id);
+  assert (d);
+  s = btor_slsutils_compute_score_node (
+      btor, bv_model, btor->fun_model, score, btor_node_invert (exp));
+  res       = res || s != d->as_dbl;
+  d->as_dbl = s;
+  return res;
+}
+
 /**
  * Update cone of influence.
  *
+ * Nodes are recomputed in ascending id order (ids are topologically ordered)
+ * starting from the parents of 'exps'. The parents of a node are only
+ * scheduled if its assignment (respectively its score) actually changed,
+ * i.e., the part of the cone that is not affected by a move is cut off.
+ *
  * Note: 'roots' will only be updated if 'update_roots' is true.
  *         + PROP engine: always
  *         + SLS  engine: only if an actual move is performed
@@ -107,13 +233,12 @@ btor_lsutils_update_cone (Btor *btor,
 
   double start, delta;
   uint32_t i, j;
-  int32_t id;
   BtorNode *exp, *cur;
-  BtorNodeIterator nit;
   BtorIntHashTableIterator iit;
   BtorHashTableData *d;
-  BtorNodePtrStack stack, cone;
-  BtorIntHashTable *cache;
+  BtorNodePtrStack updated;
+  BtorIntStack queue;
+  BtorIntHashTable *queued;
   BtorBitVector *bv, *e[3], *ass;
   BtorMemMgr *mm;
 
@@ -125,6 +250,7 @@ btor_lsutils_update_cone (Btor *btor,
   BtorPtrHashTableIterator pit;
   BtorNode *root;
   btor_iter_hashptr_init (&pit, btor->unsynthesized_constraints);
+  btor_iter_hashptr_queue (&pit, btor->synthesized_constraints);
   btor_iter_hashptr_queue (&pit, btor->assumptions);
   while (btor_iter_hashptr_has_next (&pit))
   {
@@ -140,57 +266,31 @@ btor_lsutils_update_cone (Btor *btor,
   }
 #endif
 
-  /* reset cone ----------------------------------------------------------- */
+  BTOR_INIT_STACK (mm, updated);
+  BTOR_INIT_STACK (mm, queue);
+  queued = btor_hashint_table_new (mm);
+
+  /* update assignment of exps, schedule parents --------------------------- */
 
-  BTOR_INIT_STACK (mm, cone);
-  BTOR_INIT_STACK (mm, stack);
   btor_iter_hashint_init (&iit, exps);
   while (btor_iter_hashint_has_next (&iit))
   {
+    ass = (BtorBitVector *) exps->data[iit.cur_pos].as_ptr;
     exp = btor_node_get_by_id (btor, btor_iter_hashint_next (&iit));
     assert (btor_node_is_regular (exp));
     assert (btor_node_is_bv_var (exp));
-    BTOR_PUSH_STACK (stack, exp);
-  }
-  cache = btor_hashint_table_new (mm);
-  while (!BTOR_EMPTY_STACK (stack))
-  {
-    cur = BTOR_POP_STACK (stack);
-    assert (btor_node_is_regular (cur));
-    if (btor_hashint_table_contains (cache, cur->id)) continue;
-    btor_hashint_table_add (cache, cur->id);
-    if (!btor_hashint_table_contains (exps, cur->id))
-      BTOR_PUSH_STACK (cone, cur);
     *stats_updates += 1;
 
-    /* push parents */
-    btor_iter_parent_init (&nit, cur);
-    while (btor_iter_parent_has_next (&nit))
-      BTOR_PUSH_STACK (stack, btor_iter_parent_next (&nit));
-  }
-  BTOR_RELEASE_STACK (stack);
-  btor_hashint_table_delete (cache);
-
-  *time_update_cone_reset += btor_util_time_stamp () - delta;
-
-  /* update assignment and score of exps ----------------------------------- */
-
-  btor_iter_hashint_init (&iit, exps);
-  while (btor_iter_hashint_has_next (&iit))
-  {
-    ass = (BtorBitVector *) exps->data[iit.cur_pos].as_ptr;
-    exp = btor_node_get_by_id (btor, btor_iter_hashint_next (&iit));
-
     /* update model */
     d = btor_hashint_map_get (bv_model, exp->id);
     assert (d);
+    /* old assignment == new assignment */
+    if (!btor_bv_compare (d->as_ptr, ass)) continue;
     if (update_roots
         && (exp->constraint || btor_hashptr_table_get (btor->assumptions, exp)
             || btor_hashptr_table_get (btor->assumptions,
-                                       btor_node_invert (exp)))
-        && btor_bv_compare (d->as_ptr, ass))
+                                       btor_node_invert (exp))))
     {
-      /* old assignment != new assignment */
       update_roots_table (btor, roots, exp, ass);
     }
     btor_bv_free (mm, d->as_ptr);
@@ -200,87 +300,35 @@ btor_lsutils_update_cone (Btor *btor,
       btor_bv_free (mm, d->as_ptr);
       d->as_ptr = btor_bv_not (mm, ass);
     }
-
-    /* update score */
-    if (score && btor_node_bv_get_width (btor, exp) == 1)
-    {
-      assert (btor_hashint_map_contains (score, btor_node_get_id (exp)));
-      btor_hashint_map_get (score, btor_node_get_id (exp))->as_dbl =
-          btor_slsutils_compute_score_node (
-              btor, bv_model, btor->fun_model, score, exp);
-
-      assert (btor_hashint_map_contains (score, -btor_node_get_id (exp)));
-      btor_hashint_map_get (score, -btor_node_get_id (exp))->as_dbl =
-          btor_slsutils_compute_score_node (
-              btor, bv_model, btor->fun_model, score, btor_node_invert (exp));
-    }
+    BTOR_PUSH_STACK (updated, exp);
+    queue_parents (&queue, queued, exp);
   }
 
-  qsort (cone.start,
-         BTOR_COUNT_STACK (cone),
-         sizeof (BtorNode *),
-         btor_node_compare_by_id_qsort_asc);
+  *time_update_cone_reset += btor_util_time_stamp () - delta;
 
   /* update model of cone ------------------------------------------------- */
 
   delta = btor_util_time_stamp ();
 
-  for (i = 0; i < BTOR_COUNT_STACK (cone); i++)
+  while (!BTOR_EMPTY_STACK (queue))
   {
-    cur = BTOR_PEEK_STACK (cone, i);
+    cur = btor_node_get_by_id (btor, btor_intheap_pop (&queue));
     assert (btor_node_is_regular (cur));
+    *stats_updates += 1;
     for (j = 0; j < cur->arity; j++)
-    {
-      if (btor_node_is_bv_const (cur->e[j]))
-      {
-        e[j] =
-            btor_node_is_inverted (cur->e[j])
-                ? btor_bv_copy (mm, btor_node_bv_const_get_invbits (cur->e[j]))
-                : btor_bv_copy (mm, btor_node_bv_const_get_bits (cur->e[j]));
-      }
-      else
-      {
-        d = btor_hashint_map_get (bv_model,
-                                  btor_node_real_addr (cur->e[j])->id);
-        /* Note: generate model enabled branch for ite (and does not
-         * generate model for nodes in the branch, hence !b may happen */
-        if (!d)
-          e[j] = btor_model_recursively_compute_assignment (
-              btor, bv_model, btor->fun_model, cur->e[j]);
-        else
-          e[j] = btor_node_is_inverted (cur->e[j])
-                     ? btor_bv_not (mm, d->as_ptr)
-                     : btor_bv_copy (mm, d->as_ptr);
-      }
-    }
-    switch (cur->kind)
-    {
-      case BTOR_BV_ADD_NODE: bv = btor_bv_add (mm, e[0], e[1]); break;
-      case BTOR_BV_AND_NODE: bv = btor_bv_and (mm, e[0], e[1]); break;
-      case BTOR_BV_EQ_NODE: bv = btor_bv_eq (mm, e[0], e[1]); break;
-      case BTOR_BV_ULT_NODE: bv = btor_bv_ult (mm, e[0], e[1]); break;
-      case BTOR_BV_SLL_NODE: bv = btor_bv_sll (mm, e[0], e[1]); break;
-      case BTOR_BV_SRL_NODE: bv = btor_bv_srl (mm, e[0], e[1]); break;
-      case BTOR_BV_MUL_NODE: bv = btor_bv_mul (mm, e[0], e[1]); break;
-      case BTOR_BV_UDIV_NODE: bv = btor_bv_udiv (mm, e[0], e[1]); break;
-      case BTOR_BV_UREM_NODE: bv = btor_bv_urem (mm, e[0], e[1]); break;
-      case BTOR_BV_CONCAT_NODE: bv = btor_bv_concat (mm, e[0], e[1]); break;
-      case BTOR_BV_SLICE_NODE:
-        bv = btor_bv_slice (mm,
-                            e[0],
-                            btor_node_bv_slice_get_upper (cur),
-                            btor_node_bv_slice_get_lower (cur));
-        break;
-      default:
-        assert (btor_node_is_cond (cur));
-        bv = btor_bv_is_true (e[0]) ? btor_bv_copy (mm, e[1])
-                                    : btor_bv_copy (mm, e[2]);
-    }
-
-    /* update assignment */
+      e[j] = get_child_value (btor, bv_model, cur->e[j]);
+    bv = compute_value (mm, cur, e);
+    for (j = 0; j < cur->arity; j++) btor_bv_free (mm, e[j]);
 
     d = btor_hashint_map_get (bv_model, cur->id);
 
+    /* old assignment == new assignment, cut off */
+    if (d && !btor_bv_compare (d->as_ptr, bv))
+    {
+      btor_bv_free (mm, bv);
+      continue;
+    }
+
     /* update roots table */
     if (update_roots
         && (cur->constraint || btor_hashptr_table_get (btor->assumptions, cur)
@@ -288,9 +336,7 @@ btor_lsutils_update_cone (Btor *btor,
                                        btor_node_invert (cur))))
     {
       assert (d); /* must be contained, is root */
-      /* old assignment != new assignment */
-      if (btor_bv_compare (d->as_ptr, bv))
-        update_roots_table (btor, roots, cur, bv);
+      update_roots_table (btor, roots, cur, bv);
     }
 
     /* update assignments */
@@ -312,45 +358,48 @@ btor_lsutils_update_cone (Btor *btor,
       btor_bv_free (mm, d->as_ptr);
       d->as_ptr = btor_bv_not (mm, bv);
     }
-    /* cleanup */
-    for (j = 0; j < cur->arity; j++) btor_bv_free (mm, e[j]);
+    BTOR_PUSH_STACK (updated, cur);
+    queue_parents (&queue, queued, cur);
   }
   *time_update_cone_model_gen += btor_util_time_stamp () - delta;
 
   /* update score of cone ------------------------------------------------- */
 
+  /* The score of a node depends on its own assignment and on the
+   * assignments and scores of its children. Rescore all nodes with a changed
+   * assignment and their parents, and continue with the parents of nodes
+   * with a changed score. */
   if (score)
   {
     delta = btor_util_time_stamp ();
-    for (i = 0; i < BTOR_COUNT_STACK (cone); i++)
+    btor_hashint_table_delete (queued);
+    queued = btor_hashint_table_new (mm);
+    for (i = 0; i < BTOR_COUNT_STACK (updated); i++)
     {
-      cur = BTOR_PEEK_STACK (cone, i);
-      assert (btor_node_is_regular (cur));
-
-      if (btor_node_bv_get_width (btor, cur) != 1) continue;
-
-      id = btor_node_get_id (cur);
-      if (!btor_hashint_map_contains (score, id))
+      cur = BTOR_PEEK_STACK (updated, i);
+      if (!btor_hashint_table_contains (queued, cur->id))
       {
-        /* not reachable from the roots */
-        assert (!btor_hashint_map_contains (score, -id));
-        continue;
+        btor_hashint_table_add (queued, cur->id);
+        btor_intheap_push (&queue, cur->id);
       }
-      btor_hashint_map_get (score, id)->as_dbl =
-          btor_slsutils_compute_score_node (
-              btor, bv_model, btor->fun_model, score, cur);
-      assert (btor_hashint_map_contains (score, -id));
-      btor_hashint_map_get (score, -id)->as_dbl =
-          btor_slsutils_compute_score_node (
-              btor, bv_model, btor->fun_model, score, btor_node_invert (cur));
+      queue_parents (&queue, queued, cur);
+    }
+    while (!BTOR_EMPTY_STACK (queue))
+    {
+      cur = btor_node_get_by_id (btor, btor_intheap_pop (&queue));
+      if (update_score_node (btor, bv_model, score, cur))
+        queue_parents (&queue, queued, cur);
     }
     *time_update_cone_compute_score += btor_util_time_stamp () - delta;
   }
 
-  BTOR_RELEASE_STACK (cone);
+  btor_hashint_table_delete (queued);
+  BTOR_RELEASE_STACK (queue);
+  BTOR_RELEASE_STACK (updated);
 
 #ifndef NDEBUG
   btor_iter_hashptr_init (&pit, btor->unsynthesized_constraints);
+  btor_iter_hashptr_queue (&pit, btor->synthesized_constraints);
   btor_iter_hashptr_queue (&pit, btor->assumptions);
   while (btor_iter_hashptr_has_next (&pit))
   {
@@ -363,3 +412,239 @@ btor_lsutils_update_cone (Btor *btor,
 #endif
   *time_update_cone += btor_util_time_stamp () - start;
 }
+
+static double
+get_score_batch (BtorIntHashTable *score,
+                 BtorIntHashTable *pos,
+                 double *scores,
+                 uint32_t n,
+                 uint32_t k,
+                 BtorNode *exp)
+{
+  assert (score);
+  assert (pos);
+  assert (scores);
+  assert (exp);
+
+  BtorHashTableData *d;
+
+  if ((d = btor_hashint_map_get (pos, btor_node_real_addr (exp)->id)))
+    return scores[2 * (d->as_int * n + k) + btor_node_is_inverted (exp)];
+  assert (btor_hashint_map_contains (score, btor_node_get_id (exp)));
+  return btor_hashint_map_get (score, btor_node_get_id (exp))->as_dbl;
+}
+
+/**
+ * Compute the scores of given roots for a batch of candidate moves.
+ *
+ * All moves are evaluated in a single pass over the union of their cones.
+ * The assignments of a cone node under all 'n' moves are stored next to each
+ * other and 'bv_model' and 'score' are not modified.
+ */
+void
+btor_lsutils_compute_scores_batch (Btor *btor,
+                                   BtorIntHashTable *bv_model,
+                                   BtorIntHashTable *score,
+                                   BtorIntHashTable **cans,
+                                   uint32_t n,
+                                   int32_t *roots,
+                                   uint32_t nroots,
+                                   double *res,
+                                   uint64_t *stats_updates)
+{
+  assert (btor);
+  assert (bv_model);
+  assert (score);
+  assert (cans);
+  assert (n > 0);
+  assert (roots);
+  assert (res);
+  assert (stats_updates);
+
+  uint32_t i, j, k, p, ncone;
+  int32_t id;
+  BtorNode *cur;
+  BtorNodePtrStack cone;
+  BtorIntStack queue;
+  BtorIntHashTable *pos, *queued;
+  BtorIntHashTableIterator iit;
+  BtorHashTableData *d;
+  BtorBitVector **vals, *e[3], *bv, *notbv;
+  double *scores, s[2][2];
+  BtorMemMgr *mm;
+
+  mm = btor->mm;
+
+  BTOR_INIT_STACK (mm, cone);
+  BTOR_INIT_STACK (mm, queue);
+  pos    = btor_hashint_map_new (mm);
+  queued = btor_hashint_table_new (mm);
+
+  /* collect cone in ascending id order, inputs first ---------------------- */
+
+  for (k = 0; k < n; k++)
+  {
+    btor_iter_hashint_init (&iit, cans[k]);
+    while (btor_iter_hashint_has_next (&iit))
+    {
+      id = btor_iter_hashint_next (&iit);
+      if (btor_hashint_map_contains (pos, id)) continue;
+      cur = btor_node_get_by_id (btor, id);
+      assert (btor_node_is_regular (cur));
+      assert (btor_node_is_bv_var (cur));
+      btor_hashint_map_add (pos, id)->as_int = BTOR_COUNT_STACK (cone);
+      BTOR_PUSH_STACK (cone, cur);
+      queue_parents (&queue, queued, cur);
+    }
+  }
+  while (!BTOR_EMPTY_STACK (queue))
+  {
+    cur = btor_node_get_by_id (btor, btor_intheap_pop (&queue));
+    assert (!btor_hashint_map_contains (pos, cur->id));
+    btor_hashint_map_add (pos, cur->id)->as_int = BTOR_COUNT_STACK (cone);
+    BTOR_PUSH_STACK (cone, cur);
+    queue_parents (&queue, queued, cur);
+  }
+  btor_hashint_table_delete (queued);
+  BTOR_RELEASE_STACK (queue);
+
+  ncone = BTOR_COUNT_STACK (cone);
+  *stats_updates += (uint64_t) ncone * n;
+
+  BTOR_NEWN (mm, vals, ncone * n);
+  BTOR_CNEWN (mm, scores, 2 * ncone * n);
+
+  /* compute assignments and scores of all moves node by node ------------- */
+
+  for (p = 0; p < ncone; p++)
+  {
+    cur = BTOR_PEEK_STACK (cone, p);
+
+    for (k = 0; k < n; k++)
+    {
+      if (btor_node_is_bv_var (cur))
+      {
+        d  = btor_hashint_map_get (cans[k], cur->id);
+        bv = d ? d->as_ptr : btor_hashint_map_get (bv_model, cur->id)->as_ptr;
+        bv = btor_bv_copy (mm, bv);
+        e[0] = e[1] = e[2] = 0;
+      }
+      else
+      {
+        for (j = 0; j < cur->arity; j++)
+        {
+          d = btor_hashint_map_get (pos, btor_node_real_addr (cur->e[j])->id);
+          if (d)
+            e[j] = btor_node_is_inverted (cur->e[j])
+                       ? btor_bv_not (mm, vals[d->as_int * n + k])
+                       : btor_bv_copy (mm, vals[d->as_int * n + k]);
+          else
+            e[j] = get_child_value (btor, bv_model, cur->e[j]);
+        }
+        bv = compute_value (mm, cur, e);
+      }
+      vals[p * n + k] = bv;
+
+      if (btor_node_bv_get_width (btor, cur) == 1
+          && btor_hashint_map_contains (score, cur->id))
+      {
+        if (btor_node_is_bv_and (cur))
+        {
+          s[0][0] = get_score_batch (score, pos, scores, n, k, cur->e[0]);
+          s[0][1] = get_score_batch (score, pos, scores, n, k, cur->e[1]);
+          s[1][0] = get_score_batch (
+              score, pos, scores, n, k, btor_node_invert (cur->e[0]));
+          s[1][1] = get_score_batch (
+              score, pos, scores, n, k, btor_node_invert (cur->e[1]));
+        }
+        else
+        {
+          s[0][0] = s[0][1] = s[1][0] = s[1][1] = 0.0;
+        }
+        notbv = btor_bv_not (mm, bv);
+        scores[2 * (p * n + k)] = btor_slsutils_compute_score_values (
+            btor, cur, bv, e[0], e[1], s[0][0], s[0][1]);
+        scores[2 * (p * n + k) + 1] =
+            btor_slsutils_compute_score_values (btor,
+                                                btor_node_invert (cur),
+                                                notbv,
+                                                e[0],
+                                                e[1],
+                                                s[1][0],
+                                                s[1][1]);
+        btor_bv_free (mm, notbv);
+      }
+      if (!btor_node_is_bv_var (cur))
+        for (j = 0; j < cur->arity; j++) btor_bv_free (mm, e[j]);
+    }
+  }
+
+  /* collect scores of roots ---------------------------------------------- */
+
+  for (k = 0; k < n; k++)
+    for (i = 0; i < nroots; i++)
+    {
+      cur = btor_node_get_by_id (btor, roots[i]);
+      res[k * nroots + i] = get_score_batch (score, pos, scores, n, k, cur);
+    }
+
+  for (i = 0; i < ncone * n; i++) btor_bv_free (mm, vals[i]);
+  BTOR_DELETEN (mm, vals, ncone * n);
+  BTOR_DELETEN (mm, scores, 2 * ncone * n);
+  btor_hashint_map_delete (pos);
+  BTOR_RELEASE_STACK (cone);
+}
+
+void
+btor_lsutils_init_model (Btor *btor, BtorIntHashTable *bv_model)
+{
+  assert (btor);
+  assert (bv_model);
+
+  BtorNode *var;
+  BtorHashTableData *d;
+  BtorPtrHashTableIterator it;
+
+  btor_model_init_bv (btor, &btor->bv_model);
+  btor_model_init_fun (btor, &btor->fun_model);
+
+  btor_iter_hashptr_init (&it, btor->bv_vars);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    var = btor_iter_hashptr_next (&it);
+    if (btor_node_is_proxy (var)) continue;
+    if ((d = btor_hashint_map_get (bv_model, var->id)))
+      btor_model_add_to_bv (btor, btor->bv_model, var, d->as_ptr);
+  }
+  btor_model_generate (btor, btor->bv_model, btor->fun_model, false);
+}
+
+void
+btor_lsutils_update_best_model (Btor *btor,
+                                BtorIntHashTable *roots,
+                                BtorIntHashTable **best,
+                                uint32_t *best_nroots)
+{
+  assert (btor);
+  assert (btor->bv_model);
+  assert (roots);
+  assert (best);
+  assert (best_nroots);
+
+  BtorNode *var;
+  BtorHashTableData *d;
+  BtorPtrHashTableIterator it;
+
+  if (*best && roots->count >= *best_nroots) return;
+
+  btor_model_init_bv (btor, best);
+  btor_iter_hashptr_init (&it, btor->bv_vars);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    var = btor_iter_hashptr_next (&it);
+    if (btor_node_is_proxy (var)) continue;
+    if ((d = btor_hashint_map_get (btor->bv_model, var->id)))
+      btor_model_add_to_bv (btor, *best, var, d->as_ptr);
+  }
+  *best_nroots = roots->count;
+}
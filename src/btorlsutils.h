@@ -32,4 +32,36 @@ void btor_lsutils_update_cone (Btor* btor,
                                double* time_update_cone_model_gen,
                                double* time_update_cone_compute_score);
 
+/**
+ * Compute the scores of 'nroots' roots (given by their signed ids) for each of
+ * the 'n' candidate moves 'cans' (maps from input id to new assignment) in one
+ * pass over the cone of the inputs, without updating 'bv_model' and 'score'.
+ * The score of root i under move k is stored in res[k * nroots + i].
+ */
+void btor_lsutils_compute_scores_batch (Btor* btor,
+                                        BtorIntHashTable* bv_model,
+                                        BtorIntHashTable* score,
+                                        BtorIntHashTable** cans,
+                                        uint32_t n,
+                                        int32_t* roots,
+                                        uint32_t nroots,
+                                        double* res,
+                                        uint64_t* stats_updates);
+
+/**
+ * Initialize 'btor->bv_model' and 'btor->fun_model' with the assignments of
+ * bit-vector variables given in 'bv_model' (all other variables are
+ * initialized with zero), and compute the model values of all other nodes.
+ */
+void btor_lsutils_init_model (Btor* btor, BtorIntHashTable* bv_model);
+
+/**
+ * Save the current assignment of all bit-vector variables to 'best' if the
+ * number of unsatisfied 'roots' is smaller than 'best_nroots'.
+ */
+void btor_lsutils_update_best_model (Btor* btor,
+                                     BtorIntHashTable* roots,
+                                     BtorIntHashTable** best,
+                                     uint32_t* best_nroots);
+
 #endif
@@ -537,7 +537,8 @@ btor_opt_init_opts (Btor *btor)
             0,
             1,
             "run prop engine as preprocessing within a sequential portfolio "
-            "(QF_BV only)");
+            "(on the Ackermannized bit-vector abstraction if the formula has "
+            "UFs or arrays, no function equalities)");
   init_opt (btor,
             BTOR_OPT_FUN_PRESLS,
             false,
@@ -548,7 +549,8 @@ btor_opt_init_opts (Btor *btor)
             0,
             1,
             "run sls engine as preprocessing within a sequential portfolio "
-            "(QF_BV only)");
+            "(on the Ackermannized bit-vector abstraction if the formula has "
+            "UFs or arrays, no function equalities)");
   init_opt (btor,
             BTOR_OPT_FUN_DUAL_PROP,
             false,
@@ -1410,6 +1412,207 @@ btor_opt_init_opts (Btor *btor)
             0,
             1,
             "enable non-destructive term substitutions");
+  init_opt (btor,
+            BTOR_OPT_PRINT_DIMACS_STREAM,
+            true,
+            false,
+            "dump-dimacs-stream",
+            0,
+            BTOR_DIMACS_STREAM_DFLT,
+            BTOR_DIMACS_STREAM_MIN,
+            BTOR_DIMACS_STREAM_MAX,
+            "stream CNF for DIMACS printer to temporary file");
+  opts = btor_hashptr_table_new (
+      btor->mm, (BtorHashPtr) btor_hash_str, (BtorCmpPtr) strcmpoptval);
+  add_opt_help (mm,
+                opts,
+                "none",
+                BTOR_DIMACS_STREAM_NONE,
+                "keep CNF in memory");
+  add_opt_help (mm,
+                opts,
+                "plain",
+                BTOR_DIMACS_STREAM_PLAIN,
+                "stream clauses to temporary file");
+  add_opt_help (mm,
+                opts,
+                "gzip",
+                BTOR_DIMACS_STREAM_GZIP,
+                "stream clauses to temporary file and compress output");
+  btor->options[BTOR_OPT_PRINT_DIMACS_STREAM].options = opts;
+  init_opt (btor,
+            BTOR_OPT_SAT_CALL_STATS,
+            true,
+            false,
+            "sat-call-stats",
+            0,
+            0,
+            0,
+            1u << 20,
+            "number of most recent SAT calls to record statistics for");
+  init_opt (btor,
+            BTOR_OPT_CUBE_THREADS,
+            true,
+            false,
+            "cube-threads",
+            0,
+            0,
+            0,
+            UINT32_MAX,
+            "number of threads for cube-and-conquer (0: disable)");
+  init_opt (btor,
+            BTOR_OPT_CUBE_DEPTH,
+            true,
+            false,
+            "cube-depth",
+            0,
+            4,
+            1,
+            16,
+            "number of split variables for cube-and-conquer");
+  init_opt (btor,
+            BTOR_OPT_FUN_PHASES,
+            true,
+            true,
+            "fun-phases",
+            0,
+            1,
+            0,
+            1,
+            "seed phases of SAT solver with assignment of prop/sls engine "
+            "if preprocessing with prop/sls engine was not successful");
+  init_opt (btor,
+            BTOR_OPT_FUN_INC_PROP,
+            true,
+            true,
+            "fun-inc-prop",
+            0,
+            1,
+            0,
+            1,
+            "keep rho tables of UFs across refinements and only drop entries "
+            "with changed assignments");
+  init_opt (btor,
+            BTOR_OPT_FUN_WEQ_LEMMAS,
+            true,
+            true,
+            "fun-weq-lemmas",
+            0,
+            0,
+            0,
+            1,
+            "shorten array lemmas by removing index premisses implied via "
+            "weak equivalence of both read paths");
+  init_opt (btor,
+            BTOR_OPT_FUN_LEMMA_GC,
+            true,
+            false,
+            "fun-lemma-gc",
+            0,
+            0,
+            0,
+            UINT32_MAX,
+            "retire lemmas whose premise was not hit in the last n sat calls "
+            "(incremental mode only, 0: keep all lemmas)");
+  init_opt (btor,
+            BTOR_OPT_FUN_THREADS,
+            true,
+            false,
+            "fun-threads",
+            0,
+            0,
+            0,
+            UINT32_MAX,
+            "number of threads for querying assignments of initial applies "
+            "in consistency checking (0: sequential)");
+  init_opt (btor,
+            BTOR_OPT_PROP_THREADS,
+            true,
+            false,
+            "prop-threads",
+            0,
+            0,
+            0,
+            UINT32_MAX,
+            "number of concurrent walkers with diversified seeds and "
+            "options for the prop engine (0, 1: single walker)");
+  init_opt (btor,
+            BTOR_OPT_PROP_INV_CACHE,
+            true,
+            false,
+            "prop-inv-cache",
+            0,
+            4096,
+            0,
+            UINT32_MAX,
+            "maximum number of cached inverse value computations of the "
+            "prop engine (0: disable)");
+  init_opt (btor,
+            BTOR_OPT_SLS_BATCH_SIZE,
+            true,
+            false,
+            "sls-batch-size",
+            0,
+            32,
+            0,
+            UINT32_MAX,
+            "number of candidate moves of the sls engine scored per pass "
+            "over the cone of influence (0, 1: one at a time)");
+  init_opt (btor,
+            BTOR_OPT_FUN_LS_BURSTS,
+            true,
+            false,
+            "fun-ls-bursts",
+            0,
+            0,
+            0,
+            UINT32_MAX,
+            "initial limit of SAT calls interleaved with bounded prop/sls "
+            "runs if preprocessing with prop/sls engine was not successful "
+            "(0: disable)");
+  init_opt (btor,
+            BTOR_OPT_PROP_WARM_START,
+            true,
+            false,
+            "prop-warm-start",
+            0,
+            0,
+            0,
+            1,
+            "start search from the model of the previous sat call "
+            "(incremental)");
+  init_opt (btor,
+            BTOR_OPT_SLS_WARM_START,
+            true,
+            false,
+            "sls-warm-start",
+            0,
+            0,
+            0,
+            1,
+            "start search from the model of the previous sat call "
+            "(incremental)");
+  init_opt (btor,
+            BTOR_OPT_AIGPROP_LANES,
+            true,
+            false,
+            "aigprop-lanes",
+            0,
+            0,
+            0,
+            1,
+            "advance 64 walkers in lockstep on bit-parallel assignments");
+  init_opt (btor,
+            BTOR_OPT_PROP_ADAPTIVE,
+            true,
+            false,
+            "prop-adaptive",
+            0,
+            0,
+            0,
+            1,
+            "select option configurations across restarts via bandit scheme "
+            "(requires restarts)");
 }
 
 static void
@@ -1632,7 +1835,6 @@ btor_opt_set (Btor *btor, const BtorOption opt, uint32_t val)
                 "is enabled");
       val = 0;
     }
-    assert (!val || !btor_opt_get (btor, BTOR_OPT_INCREMENTAL));
   }
   else if (opt == BTOR_OPT_SAT_ENGINE)
   {
@@ -125,6 +125,10 @@ extern const char *const g_btor_se_name[BTOR_SAT_ENGINE_MAX + 1];
 #define BTOR_BETA_REDUCE_MAX BTOR_BETA_REDUCE_ALL
 #define BTOR_BETA_REDUCE_DFLT BTOR_BETA_REDUCE_NONE
 
+#define BTOR_DIMACS_STREAM_MIN BTOR_DIMACS_STREAM_NONE
+#define BTOR_DIMACS_STREAM_MAX BTOR_DIMACS_STREAM_GZIP
+#define BTOR_DIMACS_STREAM_DFLT BTOR_DIMACS_STREAM_NONE
+
 /*------------------------------------------------------------------------*/
 
 void btor_opt_init_opts (Btor *btor);
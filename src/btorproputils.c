@@ -1687,6 +1687,169 @@ check_result_binary_dbg (Btor *btor,
 }
 #endif
 
+/* -------------------------------------------------------------------------- */
+/* Inverse value cache                                                        */
+/* -------------------------------------------------------------------------- */
+
+/* Caches the deterministic part of inverse value computations (e.g., modular
+ * inverses and bounds of the solution range) for a given operator, target
+ * value 'bvt' and value 'bve' of the fixed operand. Random choices on top of
+ * these are still made for every propagation step. */
+struct BtorPropInvCacheEntry
+{
+  BtorNodeKind kind;
+  int32_t eidx;
+  BtorBitVector *bvt;
+  BtorBitVector *bve;
+  BtorBitVector *res[2];
+};
+
+typedef struct BtorPropInvCacheEntry BtorPropInvCacheEntry;
+
+static uint32_t
+hash_inv_cache_entry (BtorPropInvCacheEntry *entry)
+{
+  assert (entry);
+  return btor_bv_hash (entry->bvt) * 333444569u
+         + btor_bv_hash (entry->bve) * 76891121u + entry->kind * 456790003u
+         + entry->eidx;
+}
+
+static int32_t
+compare_inv_cache_entry (BtorPropInvCacheEntry *e0, BtorPropInvCacheEntry *e1)
+{
+  assert (e0);
+  assert (e1);
+
+  int32_t res;
+
+  if (e0->kind != e1->kind) return e0->kind < e1->kind ? -1 : 1;
+  if (e0->eidx != e1->eidx) return e0->eidx < e1->eidx ? -1 : 1;
+  if ((res = btor_bv_compare (e0->bvt, e1->bvt))) return res;
+  return btor_bv_compare (e0->bve, e1->bve);
+}
+
+static void
+delete_inv_cache_entry (BtorMemMgr *mm, BtorPropInvCacheEntry *entry)
+{
+  assert (mm);
+  assert (entry);
+
+  btor_bv_free (mm, entry->bvt);
+  btor_bv_free (mm, entry->bve);
+  if (entry->res[0]) btor_bv_free (mm, entry->res[0]);
+  if (entry->res[1]) btor_bv_free (mm, entry->res[1]);
+  BTOR_DELETE (mm, entry);
+}
+
+void
+btor_proputils_delete_inv_cache (BtorMemMgr *mm, BtorPtrHashTable *cache)
+{
+  assert (mm);
+  assert (cache);
+
+  BtorPtrHashTableIterator it;
+
+  btor_iter_hashptr_init (&it, cache);
+  while (btor_iter_hashptr_has_next (&it))
+    delete_inv_cache_entry (mm, btor_iter_hashptr_next (&it));
+  btor_hashptr_table_delete (cache);
+}
+
+static bool
+use_inv_cache (Btor *btor)
+{
+  assert (btor);
+  return btor_opt_get (btor, BTOR_OPT_ENGINE) == BTOR_ENGINE_PROP
+         && btor_opt_get (btor, BTOR_OPT_PROP_INV_CACHE) > 0;
+}
+
+static BtorPropInvCacheEntry *
+get_inv_cache (Btor *btor,
+               BtorNodeKind kind,
+               BtorBitVector *bvt,
+               BtorBitVector *bve,
+               int32_t eidx)
+{
+  assert (btor);
+  assert (bvt);
+  assert (bve);
+
+  BtorPropSolver *slv;
+  BtorPropInvCacheEntry key;
+  BtorPtrHashBucket *b;
+
+  if (!use_inv_cache (btor)) return 0;
+
+  slv = BTOR_PROP_SOLVER (btor);
+  if (slv->inv_cache)
+  {
+    key.kind = kind;
+    key.eidx = eidx;
+    key.bvt  = bvt;
+    key.bve  = bve;
+    if ((b = btor_hashptr_table_get (slv->inv_cache, &key)))
+    {
+      slv->stats.inv_cache_hits += 1;
+      return b->key;
+    }
+  }
+  slv->stats.inv_cache_misses += 1;
+  return 0;
+}
+
+static void
+add_inv_cache (Btor *btor,
+               BtorNodeKind kind,
+               BtorBitVector *bvt,
+               BtorBitVector *bve,
+               int32_t eidx,
+               BtorBitVector *res0,
+               BtorBitVector *res1)
+{
+  assert (btor);
+  assert (bvt);
+  assert (bve);
+
+  BtorPropSolver *slv;
+  BtorPropInvCacheEntry *entry;
+  BtorMemMgr *mm;
+
+  if (!use_inv_cache (btor)) return;
+
+  mm  = btor->mm;
+  slv = BTOR_PROP_SOLVER (btor);
+
+  if (!slv->inv_cache)
+  {
+    slv->inv_cache = btor_hashptr_table_new (
+        mm,
+        (BtorHashPtr) hash_inv_cache_entry,
+        (BtorCmpPtr) compare_inv_cache_entry);
+  }
+  else if (slv->inv_cache->count
+           >= btor_opt_get (btor, BTOR_OPT_PROP_INV_CACHE))
+  {
+    /* limit reached, start over */
+    btor_proputils_delete_inv_cache (mm, slv->inv_cache);
+    slv->inv_cache = btor_hashptr_table_new (
+        mm,
+        (BtorHashPtr) hash_inv_cache_entry,
+        (BtorCmpPtr) compare_inv_cache_entry);
+    slv->stats.inv_cache_flushes += 1;
+  }
+
+  BTOR_CNEW (mm, entry);
+  entry->kind   = kind;
+  entry->eidx   = eidx;
+  entry->bvt    = btor_bv_copy (mm, bvt);
+  entry->bve    = btor_bv_copy (mm, bve);
+  entry->res[0] = res0 ? btor_bv_copy (mm, res0) : 0;
+  entry->res[1] = res1 ? btor_bv_copy (mm, res1) : 0;
+  assert (!btor_hashptr_table_get (slv->inv_cache, entry));
+  btor_hashptr_table_add (slv->inv_cache, entry);
+}
+
 /* -------------------------------------------------------------------------- */
 /* INV: and                                                                   */
 /* -------------------------------------------------------------------------- */
@@ -2344,6 +2507,7 @@ inv_mul_bv (Btor *btor,
   int32_t lsbve, lsbvmul, ispow2_bve;
   uint32_t i, j, bw;
   BtorBitVector *res, *inv, *tmp, *tmp2;
+  BtorPropInvCacheEntry *c;
   BtorMemMgr *mm;
   BtorNode *e;
 #ifndef NDEBUG
@@ -2422,9 +2586,17 @@ inv_mul_bv (Btor *btor,
      * ---------------------------------------------------------------------- */
     if (lsbve)
     {
-      inv = btor_bv_mod_inverse (mm, bve);
-      res = btor_bv_mul (mm, inv, bvmul);
-      btor_bv_free (mm, inv);
+      if ((c = get_inv_cache (btor, BTOR_BV_MUL_NODE, bvmul, bve, eidx)))
+      {
+        res = btor_bv_copy (mm, c->res[0]);
+      }
+      else
+      {
+        inv = btor_bv_mod_inverse (mm, bve);
+        res = btor_bv_mul (mm, inv, bvmul);
+        btor_bv_free (mm, inv);
+        add_inv_cache (btor, BTOR_BV_MUL_NODE, bvmul, bve, eidx, res, 0);
+      }
     }
     /* ----------------------------------------------------------------------
      * bve even
@@ -2480,26 +2652,34 @@ inv_mul_bv (Btor *btor,
            * (note: bw is not necessarily power of 2 -> do not use srl)
            * -> res = c' * m^-1 (with m^-1 the mod inverse of m, m odd)
            * ---------------------------------------------------------------- */
-          tmp = btor_bv_slice (mm, bvmul, bw - 1, j);
-          res = btor_bv_uext (mm, tmp, j);
-          assert (btor_bv_get_width (res) == bw);
-          btor_bv_free (mm, tmp);
+          if ((c = get_inv_cache (btor, BTOR_BV_MUL_NODE, bvmul, bve, eidx)))
+          {
+            res = btor_bv_copy (mm, c->res[0]);
+          }
+          else
+          {
+            tmp = btor_bv_slice (mm, bvmul, bw - 1, j);
+            res = btor_bv_uext (mm, tmp, j);
+            assert (btor_bv_get_width (res) == bw);
+            btor_bv_free (mm, tmp);
 
-          tmp  = btor_bv_slice (mm, bve, bw - 1, j);
-          tmp2 = btor_bv_uext (mm, tmp, j);
-          assert (btor_bv_get_width (tmp2) == bw);
-          assert (btor_bv_get_bit (tmp2, 0));
-          inv = btor_bv_mod_inverse (mm, tmp2);
-          btor_bv_free (mm, tmp);
-          btor_bv_free (mm, tmp2);
-          tmp = res;
-          res = btor_bv_mul (mm, tmp, inv);
+            tmp  = btor_bv_slice (mm, bve, bw - 1, j);
+            tmp2 = btor_bv_uext (mm, tmp, j);
+            assert (btor_bv_get_width (tmp2) == bw);
+            assert (btor_bv_get_bit (tmp2, 0));
+            inv = btor_bv_mod_inverse (mm, tmp2);
+            btor_bv_free (mm, tmp);
+            btor_bv_free (mm, tmp2);
+            tmp = res;
+            res = btor_bv_mul (mm, tmp, inv);
+            btor_bv_free (mm, tmp);
+            btor_bv_free (mm, inv);
+            add_inv_cache (btor, BTOR_BV_MUL_NODE, bvmul, bve, eidx, res, 0);
+          }
           /* choose one of all possible values */
           for (i = 0; i < j; i++)
             btor_bv_set_bit (
                 res, bw - 1 - i, btor_rng_pick_rand (&btor->rng, 0, 1));
-          btor_bv_free (mm, tmp);
-          btor_bv_free (mm, inv);
         }
       }
     }
@@ -2539,6 +2719,7 @@ inv_udiv_bv (Btor *btor,
   uint32_t bw;
   BtorNode *e;
   BtorBitVector *res, *lo, *up, *one, *bvmax, *tmp;
+  BtorPropInvCacheEntry *c;
   BtorMemMgr *mm;
   BtorRNG *rng;
 #ifndef NDEBUG
@@ -2648,13 +2829,22 @@ inv_udiv_bv (Btor *btor,
          * lo = bve / (bvudiv + 1) + 1
          * if lo > up -> conflict */
         btor_bv_free (mm, tmp);
-        up  = btor_bv_udiv (mm, bve, bvudiv); /* upper bound */
-        tmp = btor_bv_inc (mm, bvudiv);
-        lo  = btor_bv_udiv (mm, bve, tmp); /* lower bound (excl.) */
-        btor_bv_free (mm, tmp);
-        tmp = lo;
-        lo  = btor_bv_inc (mm, tmp); /* lower bound (incl.) */
-        btor_bv_free (mm, tmp);
+        if ((c = get_inv_cache (btor, BTOR_BV_UDIV_NODE, bvudiv, bve, eidx)))
+        {
+          lo = btor_bv_copy (mm, c->res[0]);
+          up = btor_bv_copy (mm, c->res[1]);
+        }
+        else
+        {
+          up  = btor_bv_udiv (mm, bve, bvudiv); /* upper bound */
+          tmp = btor_bv_inc (mm, bvudiv);
+          lo  = btor_bv_udiv (mm, bve, tmp); /* lower bound (excl.) */
+          btor_bv_free (mm, tmp);
+          tmp = lo;
+          lo  = btor_bv_inc (mm, tmp); /* lower bound (incl.) */
+          btor_bv_free (mm, tmp);
+          add_inv_cache (btor, BTOR_BV_UDIV_NODE, bvudiv, bve, eidx, lo, up);
+        }
 
         if (btor_bv_compare (lo, up) > 0)
         {
@@ -2737,20 +2927,31 @@ inv_udiv_bv (Btor *btor,
            *      if bve * (bvudiv + 1) does not overflow
            *      else 2^bw - 1
            * lo = bve * bvudiv */
-          lo  = btor_bv_mul (mm, bve, bvudiv);
-          tmp = btor_bv_inc (mm, bvudiv);
-          if (btor_bv_is_umulo (mm, bve, tmp))
+          if ((c = get_inv_cache (
+                   btor, BTOR_BV_UDIV_NODE, bvudiv, bve, eidx)))
           {
-            btor_bv_free (mm, tmp);
-            up = btor_bv_copy (mm, bvmax);
+            lo = btor_bv_copy (mm, c->res[0]);
+            up = btor_bv_copy (mm, c->res[1]);
           }
           else
           {
-            up = btor_bv_mul (mm, bve, tmp);
-            btor_bv_free (mm, tmp);
-            tmp = btor_bv_dec (mm, up);
-            btor_bv_free (mm, up);
-            up = tmp;
+            lo  = btor_bv_mul (mm, bve, bvudiv);
+            tmp = btor_bv_inc (mm, bvudiv);
+            if (btor_bv_is_umulo (mm, bve, tmp))
+            {
+              btor_bv_free (mm, tmp);
+              up = btor_bv_copy (mm, bvmax);
+            }
+            else
+            {
+              up = btor_bv_mul (mm, bve, tmp);
+              btor_bv_free (mm, tmp);
+              tmp = btor_bv_dec (mm, up);
+              btor_bv_free (mm, up);
+              up = tmp;
+            }
+            add_inv_cache (
+                btor, BTOR_BV_UDIV_NODE, bvudiv, bve, eidx, lo, up);
           }
 
           res = btor_bv_new_random_range (mm, &btor->rng, bw, lo, up);
@@ -2799,6 +3000,7 @@ inv_urem_bv (Btor *btor,
   int32_t cmp;
   BtorNode *e;
   BtorBitVector *res, *bvmax, *tmp, *tmp2, *one, *n, *mul, *up, *sub;
+  BtorPropInvCacheEntry *c;
   BtorMemMgr *mm;
 #ifndef NDEBUG
   bool is_inv = true;
@@ -2918,6 +3120,11 @@ inv_urem_bv (Btor *btor,
               /* bvurem = 0 -> 1 <= n <= bve -------------------------------- */
               up = btor_bv_copy (mm, bve);
             }
+            else if ((c = get_inv_cache (
+                          btor, BTOR_BV_UREM_NODE, bvurem, bve, eidx)))
+            {
+              up = btor_bv_copy (mm, c->res[0]);
+            }
             else
             {
               /* e[1] > bvurem
@@ -2946,6 +3153,8 @@ inv_urem_bv (Btor *btor,
                 up = tmp2;
               }
               btor_bv_free (mm, tmp);
+              add_inv_cache (
+                  btor, BTOR_BV_UREM_NODE, bvurem, bve, eidx, up, 0);
             }
 
             if (btor_bv_is_zero (up))
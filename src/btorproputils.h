@@ -30,6 +30,9 @@ uint64_t btor_proputils_select_move_prop (Btor* btor,
                                           BtorNode** input,
                                           BtorBitVector** assignment);
 
+/* Delete cache of inverse value computations of the prop engine. */
+void btor_proputils_delete_inv_cache (BtorMemMgr* mm, BtorPtrHashTable* cache);
+
 /*------------------------------------------------------------------------*/
 
 #ifndef NDEBUG
@@ -10,6 +10,7 @@
 
 #include <assert.h>
 #include <ctype.h>
+#include <inttypes.h>
 #include <stdarg.h>
 #include <stdlib.h>
 
@@ -33,6 +34,9 @@
 
 static bool enable_dimacs_printer (BtorSATMgr *smgr);
 
+/* Number of buffered literals that triggers a flush of the clause buffer. */
+#define BTOR_SAT_CLAUSE_BUFFER_SIZE (1 << 16)
+
 /*------------------------------------------------------------------------*/
 /* wrapper functions for SAT solver API                                   */
 /*------------------------------------------------------------------------*/
@@ -44,6 +48,19 @@ add (BtorSATMgr *smgr, int32_t lit)
   smgr->api.add (smgr, lit);
 }
 
+static inline void
+add_clauses (BtorSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  size_t i;
+
+  if (smgr->api.add_clauses)
+  {
+    smgr->api.add_clauses (smgr, lits, n);
+    return;
+  }
+  for (i = 0; i < n; i++) add (smgr, lits[i]);
+}
+
 static inline void
 assume (BtorSATMgr *smgr, int32_t lit)
 {
@@ -62,6 +79,20 @@ clone (Btor *btor, BtorSATMgr *smgr)
   return smgr->api.clone (btor, smgr);
 }
 
+static inline int64_t
+conflicts (BtorSATMgr *smgr)
+{
+  if (smgr->api.conflicts) return smgr->api.conflicts (smgr);
+  return -1;
+}
+
+static inline int64_t
+decisions (BtorSATMgr *smgr)
+{
+  if (smgr->api.decisions) return smgr->api.decisions (smgr);
+  return -1;
+}
+
 static inline int32_t
 deref (BtorSATMgr *smgr, int32_t lit)
 {
@@ -112,6 +143,12 @@ melt (BtorSATMgr *smgr, int32_t lit)
   // TODO: else case warning?
 }
 
+static inline void
+phase (BtorSATMgr *smgr, int32_t lit)
+{
+  if (smgr->api.phase) smgr->api.phase (smgr, lit);
+}
+
 static inline int32_t
 repr (BtorSATMgr *smgr, int32_t lit)
 {
@@ -169,6 +206,7 @@ btor_sat_mgr_new (Btor *btor)
   BTOR_CNEW (btor->mm, smgr);
   smgr->btor   = btor;
   smgr->output = stdout;
+  BTOR_INIT_STACK (btor->mm, smgr->clause_buffer);
   return smgr;
 }
 
@@ -209,6 +247,9 @@ btor_sat_mgr_clone (Btor *btor, BtorSATMgr *smgr)
   BTOR_ABORT (!btor_sat_mgr_has_clone_support (smgr),
               "SAT solver does not support cloning");
 
+  /* Make sure that the cloned solver sees all clauses. */
+  btor_sat_flush_clauses (smgr);
+
   mm = btor->mm;
   BTOR_NEW (mm, res);
   res->solver = clone (btor, smgr);
@@ -219,6 +260,16 @@ btor_sat_mgr_clone (Btor *btor, BtorSATMgr *smgr)
           &smgr->inc_required,
           (char *) smgr + sizeof (*smgr) - (char *) &smgr->inc_required);
   BTOR_CLR (&res->term);
+  BTOR_INIT_STACK (mm, res->clause_buffer);
+  res->calls.size = smgr->calls.size;
+  res->calls.buf  = 0;
+  if (smgr->calls.buf)
+  {
+    BTOR_NEWN (mm, res->calls.buf, smgr->calls.size);
+    memcpy (res->calls.buf,
+            smgr->calls.buf,
+            smgr->calls.size * sizeof (*smgr->calls.buf));
+  }
   return res;
 }
 
@@ -250,6 +301,7 @@ btor_sat_mgr_release_cnf_id (BtorSATMgr *smgr, int32_t lit)
   if (!smgr->initialized) return;
   assert (abs (lit) <= smgr->maxvar);
   if (abs (lit) == smgr->true_lit) return;
+  btor_sat_flush_clauses (smgr);
   melt (smgr, lit);
 }
 
@@ -261,6 +313,9 @@ btor_sat_mgr_delete (BtorSATMgr *smgr)
    * reset_sat has not been called
    */
   if (smgr->initialized) btor_sat_reset (smgr);
+  BTOR_RELEASE_STACK (smgr->clause_buffer);
+  if (smgr->calls.buf)
+    BTOR_DELETEN (smgr->btor->mm, smgr->calls.buf, smgr->calls.size);
   BTOR_DELETE (smgr->btor->mm, smgr);
 }
 
@@ -334,6 +389,7 @@ init_flags (BtorSATMgr *smgr)
   smgr->initialized  = true;
   smgr->inc_required = true;
   smgr->sat_time     = 0;
+  smgr->clause_time  = 0;
 }
 
 void
@@ -345,6 +401,13 @@ btor_sat_init (BtorSATMgr *smgr)
 
   init_flags (smgr);
 
+  if (!smgr->calls.buf)
+  {
+    smgr->calls.size = btor_opt_get (smgr->btor, BTOR_OPT_SAT_CALL_STATS);
+    if (smgr->calls.size)
+      BTOR_CNEWN (smgr->btor->mm, smgr->calls.buf, smgr->calls.size);
+  }
+
   smgr->solver = init (smgr);
   enable_verbosity (smgr, btor_opt_get (smgr->btor, BTOR_OPT_VERBOSITY));
 
@@ -370,6 +433,114 @@ btor_sat_print_stats (BtorSATMgr *smgr)
             "%d SAT calls in %.1f seconds",
             smgr->satcalls,
             smgr->sat_time);
+  BTOR_MSG (smgr->btor->msg,
+            1,
+            "%d clauses transferred in %.1f seconds",
+            smgr->clauses,
+            smgr->clause_time);
+  if (smgr->satcalls)
+  {
+    BTOR_MSG (smgr->btor->msg,
+              1,
+              "%.2f seconds max SAT call time",
+              smgr->call_stats.max_time);
+    BTOR_MSG (smgr->btor->msg,
+              1,
+              "SAT call time histogram (<1ms, <10ms, <100ms, <1s, <10s, "
+              "<100s, >=100s): %u %u %u %u %u %u %u",
+              smgr->call_stats.hist[0],
+              smgr->call_stats.hist[1],
+              smgr->call_stats.hist[2],
+              smgr->call_stats.hist[3],
+              smgr->call_stats.hist[4],
+              smgr->call_stats.hist[5],
+              smgr->call_stats.hist[6]);
+  }
+}
+
+uint32_t
+btor_sat_num_call_stats (BtorSATMgr *smgr)
+{
+  assert (smgr);
+  if (!smgr->calls.buf) return 0;
+  if ((uint32_t) smgr->satcalls < smgr->calls.size) return smgr->satcalls;
+  return smgr->calls.size;
+}
+
+const BtorSATCallStats *
+btor_sat_get_call_stats (BtorSATMgr *smgr, uint32_t i)
+{
+  assert (smgr);
+  assert (i < btor_sat_num_call_stats (smgr));
+
+  uint32_t first;
+
+  first = smgr->satcalls - btor_sat_num_call_stats (smgr);
+  return &smgr->calls.buf[(first + i) % smgr->calls.size];
+}
+
+void
+btor_sat_print_call_stats (BtorSATMgr *smgr, FILE *file)
+{
+  assert (smgr);
+  assert (file);
+
+  uint32_t i, n;
+  const BtorSATCallStats *c;
+
+  n = btor_sat_num_call_stats (smgr);
+  fprintf (file,
+           "call result time new_clauses new_vars assumptions conflicts "
+           "decisions\n");
+  for (i = 0; i < n; i++)
+  {
+    c = btor_sat_get_call_stats (smgr, i);
+    fprintf (file,
+             "%d %d %.6f %d %d %d %" PRId64 " %" PRId64 "\n",
+             c->call,
+             c->result,
+             c->time,
+             c->new_clauses,
+             c->new_vars,
+             c->assumptions,
+             c->conflicts,
+             c->decisions);
+  }
+  fflush (file);
+}
+
+static void
+record_call_stats (BtorSATMgr *smgr,
+                   BtorSolverResult res,
+                   double time,
+                   int64_t confs,
+                   int64_t decs)
+{
+  uint32_t i;
+  double t;
+  BtorSATCallStats *c;
+
+  for (i = 0, t = 0.001; i < BTOR_SAT_CALL_HIST_SIZE - 1 && time >= t;
+       i++, t *= 10)
+    ;
+  smgr->call_stats.hist[i] += 1;
+  if (time > smgr->call_stats.max_time) smgr->call_stats.max_time = time;
+
+  if (smgr->calls.buf)
+  {
+    c              = &smgr->calls.buf[(smgr->satcalls - 1) % smgr->calls.size];
+    c->call        = smgr->satcalls;
+    c->result      = res;
+    c->time        = time;
+    c->new_clauses = smgr->clauses - smgr->call_stats.clauses;
+    c->new_vars    = smgr->maxvar - smgr->call_stats.maxvar;
+    c->assumptions = smgr->call_stats.assumptions;
+    c->conflicts   = confs;
+    c->decisions   = decs;
+  }
+  smgr->call_stats.clauses     = smgr->clauses;
+  smgr->call_stats.maxvar      = smgr->maxvar;
+  smgr->call_stats.assumptions = 0;
 }
 
 void
@@ -379,8 +550,31 @@ btor_sat_add (BtorSATMgr *smgr, int32_t lit)
   assert (smgr->initialized);
   assert (abs (lit) <= smgr->maxvar);
   assert (!smgr->satcalls || smgr->inc_required);
-  if (!lit) smgr->clauses++;
-  add (smgr, lit);
+  BTOR_PUSH_STACK (smgr->clause_buffer, lit);
+  if (!lit)
+  {
+    smgr->clauses++;
+    if (BTOR_COUNT_STACK (smgr->clause_buffer) >= BTOR_SAT_CLAUSE_BUFFER_SIZE)
+      btor_sat_flush_clauses (smgr);
+  }
+}
+
+void
+btor_sat_flush_clauses (BtorSATMgr *smgr)
+{
+  assert (smgr != NULL);
+
+  double start;
+
+  if (BTOR_EMPTY_STACK (smgr->clause_buffer)) return;
+  assert (smgr->initialized);
+
+  start = btor_util_time_stamp ();
+  add_clauses (smgr,
+               smgr->clause_buffer.start,
+               BTOR_COUNT_STACK (smgr->clause_buffer));
+  BTOR_RESET_STACK (smgr->clause_buffer);
+  smgr->clause_time += btor_util_time_stamp () - start;
 }
 
 BtorSolverResult
@@ -390,9 +584,16 @@ btor_sat_check_sat (BtorSATMgr *smgr, int32_t limit)
   assert (smgr->initialized);
   assert (!smgr->inc_required || btor_sat_mgr_has_incremental_support (smgr));
 
-  double start = btor_util_time_stamp ();
+  double start, wall_start;
+  int64_t confs, decs;
   int32_t sat_res;
   BtorSolverResult res;
+
+  /* Clause transfer is accounted for separately (see clause_time). */
+  btor_sat_flush_clauses (smgr);
+
+  start      = btor_util_time_stamp ();
+  wall_start = btor_util_current_time ();
   BTOR_MSG (smgr->btor->msg,
             2,
             "calling SAT solver %s with limit %d",
@@ -401,6 +602,8 @@ btor_sat_check_sat (BtorSATMgr *smgr, int32_t limit)
   assert (!smgr->satcalls || smgr->inc_required);
   smgr->satcalls++;
   setterm (smgr);
+  confs   = conflicts (smgr);
+  decs    = decisions (smgr);
   sat_res = sat (smgr, limit);
   smgr->sat_time += btor_util_time_stamp () - start;
   switch (sat_res)
@@ -409,6 +612,11 @@ btor_sat_check_sat (BtorSATMgr *smgr, int32_t limit)
     case 20: res = BTOR_RESULT_UNSAT; break;
     default: assert (sat_res == 0); res = BTOR_RESULT_UNKNOWN;
   }
+  smgr->last_result = res;
+  if (confs >= 0) confs = conflicts (smgr) - confs;
+  if (decs >= 0) decs = decisions (smgr) - decs;
+  record_call_stats (
+      smgr, res, btor_util_current_time () - wall_start, confs, decs);
   return res;
 }
 
@@ -438,6 +646,7 @@ btor_sat_reset (BtorSATMgr *smgr)
   assert (smgr != NULL);
   assert (smgr->initialized);
   BTOR_MSG (smgr->btor->msg, 2, "resetting %s", smgr->name);
+  BTOR_RESET_STACK (smgr->clause_buffer);
   reset (smgr);
   smgr->solver      = 0;
   smgr->initialized = false;
@@ -450,6 +659,7 @@ btor_sat_fixed (BtorSATMgr *smgr, int32_t lit)
   assert (smgr != NULL);
   assert (smgr->initialized);
   assert (abs (lit) <= smgr->maxvar);
+  btor_sat_flush_clauses (smgr);
   res = fixed (smgr, lit);
   return res;
 }
@@ -463,9 +673,20 @@ btor_sat_assume (BtorSATMgr *smgr, int32_t lit)
   assert (smgr->initialized);
   assert (abs (lit) <= smgr->maxvar);
   assert (!smgr->satcalls || smgr->inc_required);
+  smgr->call_stats.assumptions += 1;
   assume (smgr, lit);
 }
 
+void
+btor_sat_phase (BtorSATMgr *smgr, int32_t lit)
+{
+  assert (smgr != NULL);
+  assert (smgr->initialized);
+  assert (lit);
+  assert (abs (lit) <= smgr->maxvar);
+  phase (smgr, lit);
+}
+
 int32_t
 btor_sat_failed (BtorSATMgr *smgr, int32_t lit)
 {
@@ -490,6 +711,15 @@ dimacs_printer_init (BtorSATMgr *smgr)
   BTOR_INIT_STACK (smgr->btor->mm, printer->assumptions);
   printer->out = stdout;
 
+  /* In streaming mode, clauses are directly written to a temporary file and
+   * copied to the output when the CNF is printed (after the header). */
+  if (printer->stream != BTOR_DIMACS_STREAM_NONE)
+  {
+    printer->tmp = tmpfile ();
+    BTOR_ABORT (!printer->tmp,
+                "failed to create temporary file for DIMACS printer");
+  }
+
   /* Note: We need to explicitly do the initialization steps for 'wrapped_smgr'
    * here instead of calling btor_sat_init on 'wrapped_smgr'. Otherwise, not all
    * information is recorded correctly. */
@@ -500,14 +730,34 @@ dimacs_printer_init (BtorSATMgr *smgr)
   return printer;
 }
 
+static inline void
+dimacs_printer_record_lit (BtorCnfPrinter *printer, int32_t lit)
+{
+  if (!printer->tmp)
+    BTOR_PUSH_STACK (printer->clauses, lit);
+  else if (lit)
+    fprintf (printer->tmp, "%d ", lit);
+  else
+    fputs ("0\n", printer->tmp);
+}
+
 static void
 dimacs_printer_add (BtorSATMgr *smgr, int32_t lit)
 {
   BtorCnfPrinter *printer = (BtorCnfPrinter *) smgr->solver;
-  BTOR_PUSH_STACK (printer->clauses, lit);
+  dimacs_printer_record_lit (printer, lit);
   add (printer->smgr, lit);
 }
 
+static void
+dimacs_printer_add_clauses (BtorSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  BtorCnfPrinter *printer = (BtorCnfPrinter *) smgr->solver;
+  size_t i;
+  for (i = 0; i < n; i++) dimacs_printer_record_lit (printer, lits[i]);
+  add_clauses (printer->smgr, lits, n);
+}
+
 static void
 dimacs_printer_assume (BtorSATMgr *smgr, int32_t lit)
 {
@@ -562,42 +812,79 @@ dimacs_printer_reset (BtorSATMgr *smgr)
   BTOR_DELETE (smgr->btor->mm, wrapped_smgr);
   BTOR_RELEASE_STACK (printer->clauses);
   BTOR_RELEASE_STACK (printer->assumptions);
+  if (printer->tmp) fclose (printer->tmp);
   BTOR_DELETE (smgr->btor->mm, printer);
   smgr->solver = 0;
 }
 
+/* Appends the contents of file 'from' to file 'to'. File 'from' is
+ * positioned at its end afterwards. */
+static void
+copy_file (FILE *from, FILE *to)
+{
+  char buf[BUFSIZ];
+  size_t n;
+
+  fflush (from);
+  rewind (from);
+  while ((n = fread (buf, 1, sizeof (buf), from)) > 0) fwrite (buf, 1, n, to);
+  fseek (from, 0, SEEK_END);
+}
+
 static void
 print_dimacs (BtorSATMgr *smgr)
 {
   int32_t lit;
+  FILE *out;
   BtorCnfPrinter *printer = (BtorCnfPrinter *) smgr->solver;
 
+  out = printer->out;
+  /* Compressed output is written via a pipe to gzip, which inherits stdout. */
+  if (printer->stream == BTOR_DIMACS_STREAM_GZIP && out == stdout)
+  {
+    fflush (out);
+    if (!(out = popen ("gzip -c", "w")))
+    {
+      BTOR_MSG (smgr->btor->msg, 1, "failed to open pipe to gzip");
+      out = printer->out;
+    }
+  }
+
   /* Print CNF in DIMACS format. */
-  fprintf (printer->out, "c CNF dump %u start\n", smgr->satcalls);
-  fprintf (printer->out, "c Boolector version %s\n", BTOR_GIT_ID);
-  fprintf (printer->out, "p cnf %u %u\n", smgr->maxvar, smgr->clauses);
+  fprintf (out, "c CNF dump %u start\n", smgr->satcalls);
+  fprintf (out, "c Boolector version %s\n", BTOR_GIT_ID);
+  fprintf (out, "p cnf %u %u\n", smgr->maxvar, smgr->clauses);
 
   /* Print clauses */
-  for (size_t i = 0; i < BTOR_COUNT_STACK (printer->clauses); i++)
+  if (printer->tmp)
   {
-    lit = BTOR_PEEK_STACK (printer->clauses, i);
-    if (lit)
-      printf ("%d ", lit);
-    else
-      printf ("%d\n", lit);
+    copy_file (printer->tmp, out);
+  }
+  else
+  {
+    for (size_t i = 0; i < BTOR_COUNT_STACK (printer->clauses); i++)
+    {
+      lit = BTOR_PEEK_STACK (printer->clauses, i);
+      if (lit)
+        fprintf (out, "%d ", lit);
+      else
+        fprintf (out, "%d\n", lit);
+    }
   }
 
   /* Print assumptions */
   if (!BTOR_EMPTY_STACK (printer->assumptions))
   {
-    fprintf (printer->out, "c assumptions\n");
+    fprintf (out, "c assumptions\n");
     for (size_t i = 0; i < BTOR_COUNT_STACK (printer->assumptions); i++)
     {
       lit = BTOR_PEEK_STACK (printer->assumptions, i);
-      fprintf (printer->out, "%d\n", lit);
+      fprintf (out, "%d\n", lit);
     }
   }
-  fprintf (printer->out, "c CNF dump %u end\n", smgr->satcalls);
+  fprintf (out, "c CNF dump %u end\n", smgr->satcalls);
+
+  if (out != printer->out) pclose (out);
 }
 
 static int32_t
@@ -665,12 +952,41 @@ dimacs_printer_clone (Btor *btor, BtorSATMgr *smgr)
   BTOR_CNEW (mm, printer_clone);
   clone_int_stack (mm, &printer_clone->assumptions, &printer->assumptions);
   clone_int_stack (mm, &printer_clone->clauses, &printer->clauses);
-  printer_clone->out  = printer->out;
+  printer_clone->out    = printer->out;
+  printer_clone->stream = printer->stream;
+  if (printer->tmp)
+  {
+    printer_clone->tmp = tmpfile ();
+    BTOR_ABORT (!printer_clone->tmp,
+                "failed to create temporary file for DIMACS printer");
+    copy_file (printer->tmp, printer_clone->tmp);
+  }
   printer_clone->smgr = btor_sat_mgr_clone (btor, printer->smgr);
 
   return printer_clone;
 }
 
+static int64_t
+dimacs_printer_conflicts (BtorSATMgr *smgr)
+{
+  BtorCnfPrinter *printer = (BtorCnfPrinter *) smgr->solver;
+  return conflicts (printer->smgr);
+}
+
+static int64_t
+dimacs_printer_decisions (BtorSATMgr *smgr)
+{
+  BtorCnfPrinter *printer = (BtorCnfPrinter *) smgr->solver;
+  return decisions (printer->smgr);
+}
+
+static void
+dimacs_printer_phase (BtorSATMgr *smgr, int32_t lit)
+{
+  BtorCnfPrinter *printer = (BtorCnfPrinter *) smgr->solver;
+  phase (printer->smgr, lit);
+}
+
 static void
 dimacs_printer_setterm (BtorSATMgr *smgr)
 {
@@ -715,19 +1031,25 @@ enable_dimacs_printer (BtorSATMgr *smgr)
   BTOR_CNEW (smgr->btor->mm, printer);
   BTOR_CNEW (smgr->btor->mm, printer->smgr);
   memcpy (printer->smgr, smgr, sizeof (BtorSATMgr));
+  /* Clauses are buffered by the printer, not by the wrapped SAT manager. */
+  BTOR_INIT_STACK (smgr->btor->mm, printer->smgr->clause_buffer);
 
   /* Clear API */
   memset (&smgr->api, 0, sizeof (smgr->api));
 
+  printer->stream = btor_opt_get (smgr->btor, BTOR_OPT_PRINT_DIMACS_STREAM);
+
   smgr->solver               = printer;
   smgr->name                 = "DIMACS Printer";
   smgr->api.add              = dimacs_printer_add;
+  smgr->api.add_clauses      = dimacs_printer_add_clauses;
   smgr->api.deref            = dimacs_printer_deref;
   smgr->api.enable_verbosity = dimacs_printer_enable_verbosity;
   smgr->api.fixed            = dimacs_printer_fixed;
   smgr->api.inc_max_var      = dimacs_printer_inc_max_var;
   smgr->api.init             = dimacs_printer_init;
   smgr->api.melt             = dimacs_printer_melt;
+  smgr->api.phase            = dimacs_printer_phase;
   smgr->api.repr             = dimacs_printer_repr;
   smgr->api.reset            = dimacs_printer_reset;
   smgr->api.sat              = dimacs_printer_sat;
@@ -735,6 +1057,8 @@ enable_dimacs_printer (BtorSATMgr *smgr)
   smgr->api.set_prefix       = dimacs_printer_set_prefix;
   smgr->api.stats            = dimacs_printer_stats;
   smgr->api.setterm          = dimacs_printer_setterm;
+  smgr->api.conflicts        = dimacs_printer_conflicts;
+  smgr->api.decisions        = dimacs_printer_decisions;
 
   /* These function are used in btor_sat_mgr_has_* testers and should only be
    * set if the underlying SAT solver also has support for it. */
@@ -20,6 +20,24 @@
 
 typedef struct BtorSATMgr BtorSATMgr;
 
+/* Statistics of a single SAT call (see BTOR_OPT_SAT_CALL_STATS). */
+struct BtorSATCallStats
+{
+  int32_t call;        /* number of SAT call (starting from 1) */
+  BtorSolverResult result;
+  double time;         /* wall clock time */
+  int32_t new_clauses; /* clauses added since previous call */
+  int32_t new_vars;    /* variables added since previous call */
+  int32_t assumptions; /* number of assumptions */
+  int64_t conflicts;   /* conflicts during call, -1 if not supported */
+  int64_t decisions;   /* decisions during call, -1 if not supported */
+};
+typedef struct BtorSATCallStats BtorSATCallStats;
+
+/* Number of buckets of SAT call time histogram, bucket i counts the SAT
+ * calls with time < 10^(i-3) seconds, the last bucket all remaining. */
+#define BTOR_SAT_CALL_HIST_SIZE 7
+
 struct BtorSATMgr
 {
   /* Note: direct solver reference for PicoSAT, wrapper object for for
@@ -29,6 +47,17 @@ struct BtorSATMgr
 
   const char *name; /* solver name */
 
+  /* Literals of clauses not yet transferred to the SAT solver (0-terminated
+   * clauses, flushed in bulk via btor_sat_flush_clauses). */
+  BtorIntStack clause_buffer;
+
+  /* Ring buffer with statistics of the last 'size' SAT calls. */
+  struct
+  {
+    BtorSATCallStats *buf;
+    uint32_t size;
+  } calls;
+
   /* Note: do not change order! (btor_sat_mgr_clone relies on inc_required
    * to come first of all fields following below.) */
   bool inc_required;
@@ -39,11 +68,23 @@ struct BtorSATMgr
 
   bool initialized;
   int32_t satcalls;
+  BtorSolverResult last_result; /* result of last SAT call */
   int32_t clauses;
   int32_t true_lit;
   int32_t maxvar;
 
   double sat_time;
+  double clause_time; /* time spent transferring clauses to the solver */
+
+  /* SAT call statistics */
+  struct
+  {
+    int32_t clauses;     /* number of clauses at previous SAT call */
+    int32_t maxvar;      /* number of variables at previous SAT call */
+    int32_t assumptions; /* number of assumptions for next SAT call */
+    double max_time;     /* time of slowest SAT call */
+    uint32_t hist[BTOR_SAT_CALL_HIST_SIZE]; /* SAT call time histogram */
+  } call_stats;
 
   struct
   {
@@ -55,6 +96,8 @@ struct BtorSATMgr
   struct
   {
     void (*add) (BtorSATMgr *, int32_t); /* required */
+    /* add sequence of 0-terminated clauses, falls back to 'add' if not set */
+    void (*add_clauses) (BtorSATMgr *, const int32_t *, size_t);
     void (*assume) (BtorSATMgr *, int32_t);
     int32_t (*deref) (BtorSATMgr *, int32_t); /* required */
     void (*enable_verbosity) (BtorSATMgr *, int32_t);
@@ -63,6 +106,7 @@ struct BtorSATMgr
     int32_t (*inc_max_var) (BtorSATMgr *);
     void *(*init) (BtorSATMgr *); /* required */
     void (*melt) (BtorSATMgr *, int32_t);
+    void (*phase) (BtorSATMgr *, int32_t); /* preferred value of variable */
     int32_t (*repr) (BtorSATMgr *, int32_t);
     void (*reset) (BtorSATMgr *);           /* required */
     int32_t (*sat) (BtorSATMgr *, int32_t); /* required */
@@ -71,6 +115,8 @@ struct BtorSATMgr
     void (*stats) (BtorSATMgr *);
     void *(*clone) (Btor *btor, BtorSATMgr *);
     void (*setterm) (BtorSATMgr *);
+    int64_t (*conflicts) (BtorSATMgr *); /* total number of conflicts */
+    int64_t (*decisions) (BtorSATMgr *); /* total number of decisions */
   } api;
 };
 
@@ -79,6 +125,8 @@ struct BtorSATMgr
 struct BtorCnfPrinter
 {
   FILE *out;
+  uint32_t stream;      /* BTOR_OPT_PRINT_DIMACS_STREAM mode */
+  FILE *tmp;            /* clauses in streaming mode (instead of 'clauses') */
   BtorIntStack clauses;
   BtorIntStack assumptions;
   BtorSATMgr *smgr; /* SAT manager wrapped by DIMACS printer. */
@@ -133,16 +181,37 @@ void btor_sat_set_output (BtorSATMgr *smgr, FILE *output);
 /* Prints statistics of SAT solver. */
 void btor_sat_print_stats (BtorSATMgr *smgr);
 
+/* Returns the number of recorded SAT call statistics. */
+uint32_t btor_sat_num_call_stats (BtorSATMgr *smgr);
+
+/* Returns statistics of the i-th recorded SAT call (0 is the oldest).
+ * Only the last BTOR_OPT_SAT_CALL_STATS calls are recorded. */
+const BtorSATCallStats *btor_sat_get_call_stats (BtorSATMgr *smgr,
+                                                 uint32_t i);
+
+/* Prints recorded SAT call statistics to 'file', one line per call. */
+void btor_sat_print_call_stats (BtorSATMgr *smgr, FILE *file);
+
 /* Adds literal to the current clause of the SAT solver.
  * 0 terminates the current clause.
+ * Note: literals are buffered and transferred to the SAT solver in bulk.
  */
 void btor_sat_add (BtorSATMgr *smgr, int32_t lit);
 
+/* Transfers all buffered clauses to the SAT solver. */
+void btor_sat_flush_clauses (BtorSATMgr *smgr);
+
 /* Adds assumption to SAT solver.
  * Requires that SAT solver supports this.
  */
 void btor_sat_assume (BtorSATMgr *smgr, int32_t lit);
 
+/* Sets the preferred value of the variable of 'lit' to the value that
+ * satisfies 'lit' (used as decision phase by the SAT solver).
+ * Ignored if the SAT solver does not support this.
+ */
+void btor_sat_phase (BtorSATMgr *smgr, int32_t lit);
+
 /* Checks whether an assumption failed during
  * the last SAT solver call 'btor_sat_check_sat'.
  */
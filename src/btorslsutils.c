@@ -147,6 +147,81 @@ min_flip_inv (Btor *btor, BtorBitVector *bv1, BtorBitVector *bv2)
   return res;
 }
 
+double
+btor_slsutils_compute_score_values (Btor *btor,
+                                    BtorNode *exp,
+                                    BtorBitVector *bvexp,
+                                    BtorBitVector *bv0,
+                                    BtorBitVector *bv1,
+                                    double s0,
+                                    double s1)
+{
+  assert (btor);
+  assert (exp);
+  assert (btor_node_bv_get_width (btor, exp) == 1);
+
+  double res;
+  BtorNode *real_exp;
+
+  real_exp = btor_node_real_addr (exp);
+
+  if (btor_node_is_bv_and (real_exp))
+  {
+    /* OR */
+    if (btor_node_is_inverted (exp))
+    {
+      res = s0 > s1 ? s0 : s1;
+    }
+    /* AND */
+    else
+    {
+      res = (s0 + s1) / 2.0;
+      /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
+         choose minimum (else it might again result in 1.0) */
+      if (res == 1.0 && (s0 < 1.0 || s1 < 1.0)) res = s0 < s1 ? s0 : s1;
+    }
+  }
+  else if (btor_node_is_bv_eq (real_exp))
+  {
+    assert (bv0);
+    assert (bv1);
+    if (btor_node_is_inverted (exp))
+      res = !btor_bv_compare (bv0, bv1) ? 0.0 : 1.0;
+    else
+      res = !btor_bv_compare (bv0, bv1)
+                ? 1.0
+                : BTOR_SLS_SCORE_CFACT
+                      * (1.0
+                         - hamming_distance (btor, bv0, bv1)
+                               / (double) btor_bv_get_width (bv0));
+  }
+  else if (btor_node_is_bv_ult (real_exp))
+  {
+    assert (bv0);
+    assert (bv1);
+    if (btor_node_is_inverted (exp))
+      res = btor_bv_compare (bv0, bv1) >= 0
+                ? 1.0
+                : BTOR_SLS_SCORE_CFACT
+                      * (1.0
+                         - min_flip_inv (btor, bv0, bv1)
+                               / (double) btor_bv_get_width (bv0));
+    else
+      res = btor_bv_compare (bv0, bv1) < 0
+                ? 1.0
+                : BTOR_SLS_SCORE_CFACT
+                      * (1.0
+                         - min_flip (btor, bv0, bv1)
+                               / (double) btor_bv_get_width (bv0));
+  }
+  else
+  {
+    assert (bvexp);
+    res = btor_bv_get_bit (bvexp, 0);
+  }
+  return res;
+}
+
 double
 btor_slsutils_compute_score_node (Btor *btor,
                                   BtorIntHashTable *bv_model,
@@ -210,7 +285,7 @@ btor_slsutils_compute_score_node (Btor *btor,
         BTORLOG (3, "      sls score e[1]: %f", s1);
       }
 #endif
-      res = s0 > s1 ? s0 : s1;
+      res = btor_slsutils_compute_score_values (btor, exp, 0, 0, 0, s0, s1);
     }
     /* ---------------------------------------------------------------------- */
     /* AND                                                                    */
@@ -244,10 +319,7 @@ btor_slsutils_compute_score_node (Btor *btor,
         BTORLOG (3, "      sls score e[1]: %f", s1);
       }
 #endif
-      res = (s0 + s1) / 2.0;
-      /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
-         choose minimum (else it might again result in 1.0) */
-      if (res == 1.0 && (s0 < 1.0 || s1 < 1.0)) res = s0 < s1 ? s0 : s1;
+      res = btor_slsutils_compute_score_values (btor, exp, 0, 0, 0, s0, s1);
     }
   }
   /* ------------------------------------------------------------------------ */
@@ -276,15 +348,7 @@ btor_slsutils_compute_score_node (Btor *btor,
       btor_mem_freestr (mm, a1);
     }
 #endif
-    if (btor_node_is_inverted (exp))
-      res = !btor_bv_compare (bv0, bv1) ? 0.0 : 1.0;
-    else
-      res = !btor_bv_compare (bv0, bv1)
-                ? 1.0
-                : BTOR_SLS_SCORE_CFACT
-                      * (1.0
-                         - hamming_distance (btor, bv0, bv1)
-                               / (double) btor_bv_get_width (bv0));
+    res = btor_slsutils_compute_score_values (btor, exp, 0, bv0, bv1, 0, 0);
   }
   /* ------------------------------------------------------------------------ */
   /* ULT                                                                      */
@@ -312,20 +376,7 @@ btor_slsutils_compute_score_node (Btor *btor,
       btor_mem_freestr (mm, a1);
     }
 #endif
-    if (btor_node_is_inverted (exp))
-      res = btor_bv_compare (bv0, bv1) >= 0
-                ? 1.0
-                : BTOR_SLS_SCORE_CFACT
-                      * (1.0
-                         - min_flip_inv (btor, bv0, bv1)
-                               / (double) btor_bv_get_width (bv0));
-    else
-      res = btor_bv_compare (bv0, bv1) < 0
-                ? 1.0
-                : BTOR_SLS_SCORE_CFACT
-                      * (1.0
-                         - min_flip (btor, bv0, bv1)
-                               / (double) btor_bv_get_width (bv0));
+    res = btor_slsutils_compute_score_values (btor, exp, 0, bv0, bv1, 0, 0);
   }
   /* ------------------------------------------------------------------------ */
   /* other BOOLEAN                                                            */
@@ -344,9 +395,15 @@ btor_slsutils_compute_score_node (Btor *btor,
       btor_mem_freestr (mm, a0);
     }
 #endif
-    res = btor_bv_get_bit (((BtorBitVector *) btor_model_get_bv_aux (
-                               btor, bv_model, fun_model, exp)),
-                           0);
+    res = btor_slsutils_compute_score_values (
+        btor,
+        exp,
+        (BtorBitVector *) btor_model_get_bv_aux (
+            btor, bv_model, fun_model, exp),
+        0,
+        0,
+        0,
+        0);
   }
 
   BTORLOG (3, "      sls score : %f", res);
@@ -459,6 +516,7 @@ btor_slsutils_compute_sls_scores (Btor *btor,
 
   /* collect roots */
   btor_iter_hashptr_init (&pit, btor->unsynthesized_constraints);
+  btor_iter_hashptr_queue (&pit, btor->synthesized_constraints);
   btor_iter_hashptr_queue (&pit, btor->assumptions);
   while (btor_iter_hashptr_has_next (&pit))
     BTOR_PUSH_STACK (stack, btor_iter_hashptr_next (&pit));
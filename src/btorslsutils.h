@@ -9,9 +9,22 @@
 #ifndef BTORSLSUTILS_H_INCLUDED
 #define BTORSLSUTILS_H_INCLUDED
 
+#include "btorbv.h"
 #include "btortypes.h"
 #include "utils/btorhashint.h"
 
+/* Compute the score of 'exp' from given assignments and scores.
+ * 'bvexp' is the assignment of 'exp' (other Boolean), 'bv0' and 'bv1' are the
+ * assignments of the children of the real address of 'exp' (EQ, ULT), and
+ * 's0' and 's1' are the scores of the children in the phase of 'exp' (AND). */
+double btor_slsutils_compute_score_values (Btor *btor,
+                                           BtorNode *exp,
+                                           BtorBitVector *bvexp,
+                                           BtorBitVector *bv0,
+                                           BtorBitVector *bv1,
+                                           double s0,
+                                           double s1);
+
 double btor_slsutils_compute_score_node (Btor *btor,
                                          BtorIntHashTable *bv_model,
                                          BtorIntHashTable *fun_model,
@@ -243,6 +243,7 @@ sat_aigprop_solver (BtorAIGPropSolver *slv)
   slv->aprop->seed         = btor_opt_get (btor, BTOR_OPT_SEED);
   slv->aprop->use_restarts = btor_opt_get (btor, BTOR_OPT_AIGPROP_USE_RESTARTS);
   slv->aprop->use_bandit   = btor_opt_get (btor, BTOR_OPT_AIGPROP_USE_BANDIT);
+  slv->aprop->use_lanes    = btor_opt_get (btor, BTOR_OPT_AIGPROP_LANES);
 
   /* collect roots AIGs */
   roots = btor_hashint_table_new (btor->mm);
@@ -269,6 +270,7 @@ sat_aigprop_solver (BtorAIGPropSolver *slv)
   assert (sat_result == BTOR_RESULT_SAT);
   slv->stats.moves                  = slv->aprop->stats.moves;
   slv->stats.restarts               = slv->aprop->stats.restarts;
+  slv->stats.updates                = slv->aprop->stats.updates;
   slv->time.aprop_sat               = slv->aprop->time.sat;
   slv->time.aprop_update_cone       = slv->aprop->time.update_cone;
   slv->time.aprop_update_cone_reset = slv->aprop->time.update_cone_reset;
@@ -305,6 +307,16 @@ print_stats_aigprop_solver (BtorAIGPropSolver *slv)
             1,
             "moves per second: %.2f",
             (double) slv->stats.moves / slv->time.aprop_sat);
+  BTOR_MSG (btor->msg,
+            1,
+            "updates (cone): %llu",
+            (unsigned long long) slv->stats.updates);
+  BTOR_MSG (btor->msg,
+            1,
+            "updates (cone) per move: %.2f",
+            slv->stats.moves
+                ? (double) slv->stats.updates / slv->stats.moves
+                : 0.0);
 }
 
 static void
@@ -373,7 +385,8 @@ btor_new_aigprop_solver (Btor *btor)
       btor_opt_get (btor, BTOR_OPT_LOGLEVEL),
       btor_opt_get (btor, BTOR_OPT_SEED),
       btor_opt_get (btor, BTOR_OPT_AIGPROP_USE_RESTARTS),
-      btor_opt_get (btor, BTOR_OPT_AIGPROP_USE_BANDIT));
+      btor_opt_get (btor, BTOR_OPT_AIGPROP_USE_BANDIT),
+      btor_opt_get (btor, BTOR_OPT_AIGPROP_LANES));
 
   BTOR_MSG (btor->msg, 1, "enabled aigprop engine");
 
@@ -25,6 +25,7 @@ struct BtorAIGPropSolver
   {
     uint32_t moves;
     uint32_t restarts;
+    uint64_t updates;
   } stats;
   struct
   {
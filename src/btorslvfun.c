@@ -12,6 +12,7 @@
 #include "btorbeta.h"
 #include "btorclone.h"
 #include "btorcore.h"
+#include "btorcube.h"
 #include "btordbg.h"
 #include "btordcr.h"
 #include "btorexp.h"
@@ -21,6 +22,7 @@
 #include "btorprintmodel.h"
 #include "btorslvprop.h"
 #include "btorslvsls.h"
+#include "preprocess/btorelimapplies.h"
 #include "utils/btorhashint.h"
 #include "utils/btorhashptr.h"
 #include "utils/btornodeiter.h"
@@ -28,6 +30,10 @@
 #include "utils/btorunionfind.h"
 #include "utils/btorutil.h"
 
+#ifdef BTOR_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
 /*------------------------------------------------------------------------*/
 
 static BtorFunSolver *
@@ -38,15 +44,64 @@ clone_fun_solver (Btor *clone, BtorFunSolver *slv, BtorNodeMap *exp_map)
   assert (slv->kind == BTOR_FUN_SOLVER_KIND);
   assert (exp_map);
 
-  uint32_t h;
+  uint32_t h, i;
   Btor *btor;
   BtorFunSolver *res;
+  BtorFunLemma l;
+  BtorNode *key, *data;
+  BtorNodeMap *dp_map;
+  BtorNodeMapIterator it;
 
   btor = slv->btor;
 
   BTOR_NEW (clone->mm, res);
   memcpy (res, slv, sizeof (BtorFunSolver));
 
+  /* rho tables are only retained within a sat call */
+  assert (BTOR_EMPTY_STACK (slv->rho_funs));
+  assert (!slv->args_cache);
+  BTOR_INIT_STACK (clone->mm, res->rho_funs);
+  BTOR_INIT_STACK (clone->mm, res->trace.lemma_sizes);
+
+  BTOR_INIT_STACK (clone->mm, res->lgc.lemmas);
+  if (BTOR_SIZE_STACK (slv->lgc.lemmas))
+  {
+    BTOR_NEWN (clone->mm,
+               res->lgc.lemmas.start,
+               BTOR_SIZE_STACK (slv->lgc.lemmas));
+    res->lgc.lemmas.end =
+        res->lgc.lemmas.start + BTOR_SIZE_STACK (slv->lgc.lemmas);
+    res->lgc.lemmas.top = res->lgc.lemmas.start;
+    for (i = 0; i < BTOR_COUNT_STACK (slv->lgc.lemmas); i++)
+    {
+      l         = slv->lgc.lemmas.start[i];
+      l.lemma   = btor_nodemap_mapped (exp_map, l.lemma);
+      l.act     = btor_nodemap_mapped (exp_map, l.act);
+      l.guarded = btor_nodemap_mapped (exp_map, l.guarded);
+      l.premise = btor_nodemap_mapped (exp_map, l.premise);
+      BTOR_PUSH_STACK (res->lgc.lemmas, l);
+    }
+  }
+
+  /* references held by the dual prop clone root and the nodes in its map
+   * are already cloned (and thus accounted for) */
+  if (slv->dp.clone)
+  {
+    res->dp.clone   = btor_clone_exp_layer (slv->dp.clone, &dp_map, true);
+    res->dp.root    = btor_nodemap_mapped (dp_map, slv->dp.root);
+    res->dp.exp_map = btor_nodemap_new (res->dp.clone);
+    btor_iter_nodemap_init (&it, slv->dp.exp_map);
+    while (btor_iter_nodemap_has_next (&it))
+    {
+      data = btor_nodemap_mapped (dp_map, it.it.bucket->data.as_ptr);
+      key  = btor_nodemap_mapped (exp_map, btor_iter_nodemap_next (&it));
+      btor_nodemap_map (res->dp.exp_map, key, data);
+      btor_node_release (clone, key);
+      btor_node_release (res->dp.clone, data);
+    }
+    btor_nodemap_delete (dp_map);
+  }
+
   res->btor   = clone;
   res->lemmas = btor_hashptr_table_clone (
       clone->mm, slv->lemmas, btor_clone_key_as_node, 0, exp_map, 0);
@@ -97,6 +152,23 @@ clone_fun_solver (Btor *clone, BtorFunSolver *slv, BtorNodeMap *exp_map)
   return res;
 }
 
+static void
+delete_retained_rho_tables (BtorFunSolver *slv)
+{
+  assert (slv);
+
+  BtorNode *fun;
+
+  while (!BTOR_EMPTY_STACK (slv->rho_funs))
+  {
+    fun = BTOR_POP_STACK (slv->rho_funs);
+    assert (fun->rho);
+    btor_hashptr_table_delete (fun->rho);
+    fun->rho = 0;
+    btor_node_release (slv->btor, fun);
+  }
+}
+
 static void
 delete_fun_solver (BtorFunSolver *slv)
 {
@@ -105,6 +177,7 @@ delete_fun_solver (BtorFunSolver *slv)
   assert (slv->btor);
   assert (slv->btor->slv == (BtorSolver *) slv);
 
+  uint32_t i;
   BtorPtrHashTable *t;
   BtorPtrHashTableIterator it, iit;
   BtorNode *exp;
@@ -144,6 +217,25 @@ delete_fun_solver (BtorFunSolver *slv)
     btor_hashptr_table_delete (slv->score);
   }
 
+  delete_retained_rho_tables (slv);
+  BTOR_RELEASE_STACK (slv->rho_funs);
+  BTOR_RELEASE_STACK (slv->trace.lemma_sizes);
+
+  for (i = 0; i < BTOR_COUNT_STACK (slv->lgc.lemmas); i++)
+  {
+    btor_node_release (btor, slv->lgc.lemmas.start[i].act);
+    btor_node_release (btor, slv->lgc.lemmas.start[i].guarded);
+    btor_node_release (btor, slv->lgc.lemmas.start[i].premise);
+  }
+  BTOR_RELEASE_STACK (slv->lgc.lemmas);
+
+  if (slv->dp.clone)
+  {
+    btor_nodemap_delete (slv->dp.exp_map);
+    btor_node_release (slv->dp.clone, slv->dp.root);
+    btor_delete (slv->dp.clone);
+  }
+
   BTOR_RELEASE_STACK (slv->cur_lemmas);
   BTOR_RELEASE_STACK (slv->stats.lemmas_size);
   BTOR_DELETE (btor->mm, slv);
@@ -208,6 +300,20 @@ incremental_required (Btor *btor)
   return res;
 }
 
+/* Interleave bounded SAT calls with bounded prop/sls runs? Only for formulas
+ * supported by prop/sls, i.e., without functions. */
+static bool
+use_ls_bursts (Btor *btor)
+{
+  assert (btor);
+  return btor_opt_get (btor, BTOR_OPT_FUN_LS_BURSTS)
+         && (btor_opt_get (btor, BTOR_OPT_FUN_PREPROP)
+             || btor_opt_get (btor, BTOR_OPT_FUN_PRESLS))
+         && btor->ufs->count == 0 && btor->feqs->count == 0
+         && btor->lambdas->count == 0
+         && btor_sat_mgr_has_incremental_support (btor_get_sat_mgr (btor));
+}
+
 static void
 configure_sat_mgr (Btor *btor)
 {
@@ -221,7 +327,7 @@ configure_sat_mgr (Btor *btor)
   /* reset SAT solver to non-incremental if all functions have been
    * eliminated */
   if (!btor_opt_get (btor, BTOR_OPT_INCREMENTAL) && smgr->inc_required
-      && !incremental_required (btor))
+      && !incremental_required (btor) && !use_ls_bursts (btor))
   {
     smgr->inc_required = false;
     BTOR_MSG (btor->msg,
@@ -365,8 +471,8 @@ new_exp_layer_clone_for_dual_prop (Btor *btor,
   btor_opt_set_str (clone, BTOR_OPT_SAT_ENGINE, "plain=1");
   configure_sat_mgr (clone);
 
+  /* assumptions are added per sat call, see dual_prop_clone_root */
   btor_iter_hashptr_init (&it, clone->unsynthesized_constraints);
-  btor_iter_hashptr_queue (&it, clone->assumptions);
   while (btor_iter_hashptr_has_next (&it))
   {
     cur                                   = btor_iter_hashptr_next (&it);
@@ -928,6 +1034,66 @@ add_lemma_to_dual_prop_clone (Btor *btor,
   *root = and;
 }
 
+/* Add constraints that were added to 'btor' since the last sat call to the
+ * root of the (persistent) dual prop clone. */
+static void
+add_constraints_to_dual_prop_clone (Btor *btor)
+{
+  assert (btor);
+  assert (btor->slv);
+  assert (btor->slv->kind == BTOR_FUN_SOLVER_KIND);
+  assert (BTOR_FUN_SOLVER (btor)->dp.clone);
+
+  BtorFunSolver *slv;
+  BtorPtrHashTableIterator it;
+
+  slv = BTOR_FUN_SOLVER (btor);
+
+  btor_iter_hashptr_init (&it, btor->unsynthesized_constraints);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    add_lemma_to_dual_prop_clone (btor,
+                                  slv->dp.clone,
+                                  &slv->dp.root,
+                                  btor_iter_hashptr_next (&it),
+                                  slv->dp.exp_map);
+    slv->stats.dp_clone_constraints += 1;
+  }
+}
+
+/* Get the root of the dual prop clone for the current sat call, i.e., the
+ * conjunction of its (persistent) root and the current assumptions. */
+static BtorNode *
+dual_prop_clone_root (Btor *btor)
+{
+  assert (btor);
+  assert (btor->slv);
+  assert (btor->slv->kind == BTOR_FUN_SOLVER_KIND);
+  assert (BTOR_FUN_SOLVER (btor)->dp.clone);
+
+  BtorFunSolver *slv;
+  BtorNode *res, *cur, *and;
+  BtorPtrHashTableIterator it;
+
+  slv = BTOR_FUN_SOLVER (btor);
+  res = btor_node_copy (slv->dp.clone, slv->dp.root);
+
+  btor_iter_hashptr_init (&it, btor->assumptions);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    cur = btor_clone_recursively_rebuild_exp (btor,
+                                              slv->dp.clone,
+                                              btor_iter_hashptr_next (&it),
+                                              slv->dp.exp_map,
+                                              0);
+    and = btor_exp_bv_and (slv->dp.clone, res, cur);
+    btor_node_release (slv->dp.clone, cur);
+    btor_node_release (slv->dp.clone, res);
+    res = and;
+  }
+  return res;
+}
+
 /*------------------------------------------------------------------------*/
 
 static void
@@ -1161,6 +1327,76 @@ search_initial_applies_just (Btor *btor, BtorNodePtrStack *top_applies)
       btor_util_time_stamp () - start;
 }
 
+/* Assignment of the arguments of an args node (cached per consistency check,
+ * see get_args_assignment). */
+struct BtorFunArgsAssignment
+{
+  BtorBitVectorTuple *bvs;
+  uint32_t hash;
+};
+
+typedef struct BtorFunArgsAssignment BtorFunArgsAssignment;
+
+static void
+delete_args_assignments (Btor *btor, BtorIntHashTable *cache)
+{
+  assert (btor);
+  assert (cache);
+
+  BtorFunArgsAssignment *a;
+  BtorIntHashTableIterator it;
+
+  btor_iter_hashint_init (&it, cache);
+  while (btor_iter_hashint_has_next (&it))
+  {
+    a = btor_iter_hashint_next_data (&it)->as_ptr;
+    btor_bv_free_tuple (btor->mm, a->bvs);
+    BTOR_DELETE (btor->mm, a);
+  }
+  btor_hashint_map_delete (cache);
+}
+
+/* Returns the cached assignment of 'args' w.r.t. the current bv model, or 0
+ * if no cache is active (outside of consistency checking, or while cloning
+ * rho tables, where 'btor->slv' still belongs to the original instance). */
+static BtorFunArgsAssignment *
+get_args_assignment (Btor *btor, BtorNode *args)
+{
+  assert (btor);
+  assert (btor_node_is_regular (args));
+  assert (btor_node_is_args (args));
+
+  uint32_t i;
+  BtorFunSolver *slv;
+  BtorFunArgsAssignment *res;
+  BtorHashTableData *d;
+  BtorArgsIterator it;
+  BtorBitVector *bv;
+
+  if (!btor->slv || btor->slv->btor != btor
+      || btor->slv->kind != BTOR_FUN_SOLVER_KIND)
+    return 0;
+  slv = BTOR_FUN_SOLVER (btor);
+  if (!slv->args_cache) return 0;
+
+  if ((d = btor_hashint_map_get (slv->args_cache, args->id))) return d->as_ptr;
+
+  BTOR_NEW (btor->mm, res);
+  res->bvs =
+      btor_bv_new_tuple (btor->mm, btor_node_args_get_arity (btor, args));
+  res->hash = 0;
+  btor_iter_args_init (&it, args);
+  for (i = 0; btor_iter_args_has_next (&it); i++)
+  {
+    bv = get_bv_assignment (btor, btor_iter_args_next (&it));
+    res->hash += btor_bv_hash (bv);
+    btor_bv_add_to_tuple (btor->mm, res->bvs, bv, i);
+    btor_bv_free (btor->mm, bv);
+  }
+  btor_hashint_map_add (slv->args_cache, args->id)->as_ptr = res;
+  return res;
+}
+
 static bool
 equal_bv_assignments (BtorNode *exp0, BtorNode *exp1)
 {
@@ -1170,8 +1406,20 @@ equal_bv_assignments (BtorNode *exp0, BtorNode *exp1)
   bool equal;
   Btor *btor;
   BtorBitVector *bv0, *bv1;
+  BtorHashTableData *d0, *d1;
+
+  btor = btor_node_real_addr (exp0)->btor;
+  exp0 = btor_node_get_simplified (btor, exp0);
+  exp1 = btor_node_get_simplified (btor, exp1);
+
+  /* compare cached assignments without copying them */
+  if (btor_node_is_inverted (exp0) == btor_node_is_inverted (exp1)
+      && (d0 = btor_hashint_map_get (btor->bv_model,
+                                     btor_node_real_addr (exp0)->id))
+      && (d1 = btor_hashint_map_get (btor->bv_model,
+                                     btor_node_real_addr (exp1)->id)))
+    return btor_bv_compare (d0->as_ptr, d1->as_ptr) == 0;
 
-  btor  = btor_node_real_addr (exp0)->btor;
   bv0   = get_bv_assignment (btor, exp0);
   bv1   = get_bv_assignment (btor, exp1);
   equal = btor_bv_compare (bv0, bv1) == 0;
@@ -1195,11 +1443,20 @@ compare_args_assignments (BtorNode *e0, BtorNode *e1)
   BtorNode *arg0, *arg1;
   Btor *btor;
   BtorArgsIterator it0, it1;
+  BtorFunArgsAssignment *a0, *a1;
   btor = e0->btor;
 
   if (btor_node_get_sort_id (e0) != btor_node_get_sort_id (e1)) return 1;
 
   if (e0 == e1) return 0;
+
+  if ((a0 = get_args_assignment (btor, e0))
+      && (a1 = get_args_assignment (btor, e1)))
+  {
+    if (a0->hash != a1->hash) return 1;
+    return btor_bv_compare_tuple (a0->bvs, a1->bvs) == 0 ? 0 : 1;
+  }
+
   btor_iter_args_init (&it0, e0);
   btor_iter_args_init (&it1, e1);
 
@@ -1234,8 +1491,11 @@ hash_args_assignment (BtorNode *exp)
   BtorNode *arg;
   BtorArgsIterator it;
   BtorBitVector *bv;
+  BtorFunArgsAssignment *a;
 
   btor = exp->btor;
+  if ((a = get_args_assignment (btor, exp))) return a->hash;
+
   hash = 0;
   btor_iter_args_init (&it, exp);
   while (btor_iter_args_has_next (&it))
@@ -1414,6 +1674,86 @@ mk_premise (Btor *btor, BtorNode *args, BtorNode *prem[], uint32_t num_prem)
   return res;
 }
 
+/* Remove duplicate premisses from 'prem', and premisses that also occur in
+ * 'other' (if given). For function congruence lemmas, the arguments of both
+ * applies are equal, hence an index disequality on the read path of one apply
+ * implies the same disequality on the path of the other one (both arrays are
+ * weakly equivalent modulo the indices on the path). Returns the number of
+ * removed premisses. */
+static uint32_t
+remove_redundant_premisses (Btor *btor,
+                            BtorNodePtrStack *prem,
+                            BtorNodePtrStack *other)
+{
+  assert (btor);
+  assert (prem);
+
+  uint32_t i, j;
+  BtorNode *cur;
+  BtorIntHashTable *cache;
+
+  cache = btor_hashint_table_new (btor->mm);
+  if (other)
+  {
+    for (i = 0; i < BTOR_COUNT_STACK (*other); i++)
+      btor_hashint_table_add (cache,
+                              btor_node_get_id (BTOR_PEEK_STACK (*other, i)));
+  }
+
+  for (i = 0, j = 0; i < BTOR_COUNT_STACK (*prem); i++)
+  {
+    cur = BTOR_PEEK_STACK (*prem, i);
+    if (btor_hashint_table_contains (cache, btor_node_get_id (cur)))
+    {
+      btor_node_release (btor, cur);
+      continue;
+    }
+    btor_hashint_table_add (cache, btor_node_get_id (cur));
+    prem->start[j++] = cur;
+  }
+  btor_hashint_table_delete (cache);
+  prem->top = prem->start + j;
+  return i - j;
+}
+
+static bool
+lemma_gc_enabled (Btor *btor)
+{
+  return btor_opt_get (btor, BTOR_OPT_FUN_LEMMA_GC)
+         && btor_opt_get (btor, BTOR_OPT_INCREMENTAL)
+         && !BTOR_FUN_SOLVER (btor)->assume_lemmas;
+}
+
+/* Create an activation literal 'act' for 'lemma' with premise 'premise' and
+ * return the guarded lemma 'act -> lemma'. The activation literal is assumed
+ * in every sat call until the lemma is retired. */
+static BtorNode *
+new_guarded_lemma (Btor *btor, BtorNode *lemma, BtorNode *premise)
+{
+  assert (btor);
+  assert (btor->slv);
+  assert (btor->slv->kind == BTOR_FUN_SOLVER_KIND);
+  assert (lemma);
+  assert (premise);
+
+  BtorFunSolver *slv;
+  BtorFunLemma l;
+  BtorSortId sort;
+
+  slv = BTOR_FUN_SOLVER (btor);
+
+  sort        = btor_sort_bool (btor);
+  l.lemma     = lemma;
+  l.act       = btor_exp_var (btor, sort, 0);
+  l.guarded   = btor_exp_implies (btor, l.act, lemma);
+  l.premise   = btor_node_copy (btor, premise);
+  l.hits      = 0;
+  l.last_call = slv->lgc.calls;
+  btor_sort_release (btor, sort);
+  BTOR_PUSH_STACK (slv->lgc.lemmas, l);
+  return l.guarded;
+}
+
 static void
 add_lemma (Btor *btor, BtorNode *fun, BtorNode *app1, BtorNode *app2)
 {
@@ -1430,6 +1770,7 @@ add_lemma (Btor *btor, BtorNode *fun, BtorNode *app1, BtorNode *app2)
   assert (!app2 || btor_node_is_regular (app2) || btor_node_is_apply (app2));
 
   double start;
+  bool weq;
   uint32_t i, lemma_size = 1;
   BtorIntHashTable *cache_app1, *cache_app2;
   BtorNodePtrStack prem_app1, prem_app2, prem;
@@ -1445,10 +1786,14 @@ add_lemma (Btor *btor, BtorNode *fun, BtorNode *app1, BtorNode *app2)
   BTOR_INIT_STACK (mm, prem_app1);
   BTOR_INIT_STACK (mm, prem_app2);
   BTOR_INIT_STACK (mm, prem);
+  weq        = btor_opt_get (btor, BTOR_OPT_FUN_WEQ_LEMMAS) != 0;
+  and        = 0;
 
   /* collect premise and conclusion */
 
   collect_premisses (btor, app1, fun, app1->e[1], &prem_app1, cache_app1);
+  if (weq)
+    slv->stats.weq_removed += remove_redundant_premisses (btor, &prem_app1, 0);
   tmp = mk_premise (
       btor, app1->e[1], prem_app1.start, BTOR_COUNT_STACK (prem_app1));
 
@@ -1458,6 +1803,9 @@ add_lemma (Btor *btor, BtorNode *fun, BtorNode *app1, BtorNode *app2)
   if (app2) /* function congruence axiom conflict */
   {
     collect_premisses (btor, app2, fun, app2->e[1], &prem_app2, cache_app2);
+    if (weq)
+      slv->stats.weq_removed +=
+          remove_redundant_premisses (btor, &prem_app2, &prem_app1);
     tmp = mk_premise (
         btor, app2->e[1], prem_app2.start, BTOR_COUNT_STACK (prem_app2));
 
@@ -1505,7 +1853,6 @@ add_lemma (Btor *btor, BtorNode *fun, BtorNode *app1, BtorNode *app2)
   {
     and   = btor_exp_bv_and_n (btor, prem.start, BTOR_COUNT_STACK (prem));
     lemma = btor_exp_implies (btor, and, con);
-    btor_node_release (btor, and);
     btor_node_release (btor, con);
   }
 
@@ -1513,14 +1860,19 @@ add_lemma (Btor *btor, BtorNode *fun, BtorNode *app1, BtorNode *app2)
   if (!btor_hashptr_table_get (slv->lemmas, lemma))
   {
     btor_hashptr_table_add (slv->lemmas, btor_node_copy (btor, lemma));
-    BTOR_PUSH_STACK (slv->cur_lemmas, lemma);
+    if (and && lemma_gc_enabled (btor))
+      BTOR_PUSH_STACK (slv->cur_lemmas, new_guarded_lemma (btor, lemma, and));
+    else
+      BTOR_PUSH_STACK (slv->cur_lemmas, lemma);
     slv->stats.lod_refinements++;
     slv->stats.lemmas_size_sum += lemma_size;
     if (lemma_size >= BTOR_SIZE_STACK (slv->stats.lemmas_size))
       BTOR_FIT_STACK (slv->stats.lemmas_size, lemma_size);
     slv->stats.lemmas_size.start[lemma_size] += 1;
+    if (btor->lod_trace) BTOR_PUSH_STACK (slv->trace.lemma_sizes, lemma_size);
   }
   btor_node_release (btor, lemma);
+  if (and) btor_node_release (btor, and);
 
   /* cleanup */
   for (i = 0; i < BTOR_COUNT_STACK (prem); i++)
@@ -2227,6 +2579,236 @@ push_unreachable_applies (Btor *btor, BtorNodePtrStack *init_apps)
   btor_hashint_table_delete (cache);
 }
 
+static bool
+unchanged_assignment (Btor *btor, BtorIntHashTable *prev_model, BtorNode *exp)
+{
+  assert (btor);
+  assert (prev_model);
+  assert (exp);
+
+  bool res;
+  BtorBitVector *bv;
+  BtorHashTableData *d;
+
+  exp = btor_node_real_addr (btor_node_get_simplified (btor, exp));
+  d   = btor_hashint_map_get (prev_model, exp->id);
+  if (!d) return false;
+  bv  = get_bv_assignment (btor, exp);
+  res = btor_bv_compare (bv, d->as_ptr) == 0;
+  btor_bv_free (btor->mm, bv);
+  return res;
+}
+
+/* Rebuild the rho tables of UFs retained from the previous refinement round
+ * w.r.t. the current assignment. An entry is only kept if it stems from an
+ * apply directly on the UF and the assignments of the apply and its arguments
+ * did not change compared to the model 'prev_model' of the previous round.
+ * Kept applies do not have to be propagated again to detect congruence
+ * conflicts with other applies. */
+static void
+update_retained_rho_tables (Btor *btor,
+                            BtorIntHashTable *prev_model,
+                            BtorPtrHashTable *cleanup_table)
+{
+  assert (btor);
+  assert (btor->slv);
+  assert (btor->slv->kind == BTOR_FUN_SOLVER_KIND);
+  assert (prev_model);
+  assert (cleanup_table);
+
+  uint32_t i;
+  bool keep;
+  BtorFunSolver *slv;
+  BtorNode *fun, *app, *args;
+  BtorPtrHashTable *rho;
+  BtorPtrHashTableIterator it;
+  BtorArgsIterator ait;
+
+  slv = BTOR_FUN_SOLVER (btor);
+
+  for (i = 0; i < BTOR_COUNT_STACK (slv->rho_funs); i++)
+  {
+    fun = BTOR_PEEK_STACK (slv->rho_funs, i);
+    assert (btor_node_is_uf (fun));
+    assert (fun->rho);
+    rho      = fun->rho;
+    fun->rho = 0;
+
+    btor_iter_hashptr_init (&it, rho);
+    while (btor_iter_hashptr_has_next (&it))
+    {
+      app  = it.bucket->data.as_ptr;
+      args = btor_iter_hashptr_next (&it);
+
+      keep = !btor_node_is_simplified (fun) && !btor_node_is_simplified (app)
+             && !btor_node_is_simplified (args)
+             && btor_node_get_simplified (btor, app->e[0]) == fun
+             && unchanged_assignment (btor, prev_model, app);
+      btor_iter_args_init (&ait, args);
+      while (keep && btor_iter_args_has_next (&ait))
+        keep = unchanged_assignment (
+            btor, prev_model, btor_iter_args_next (&ait));
+
+      if (!keep || (fun->rho && btor_hashptr_table_get (fun->rho, args)))
+      {
+        slv->stats.rho_dropped++;
+        continue;
+      }
+
+      if (!fun->rho)
+      {
+        fun->rho =
+            btor_hashptr_table_new (btor->mm,
+                                    (BtorHashPtr) hash_args_assignment,
+                                    (BtorCmpPtr) compare_args_assignments);
+        if (!btor_hashptr_table_get (cleanup_table, fun))
+          btor_hashptr_table_add (cleanup_table, fun);
+      }
+      btor_hashptr_table_add (fun->rho, args)->data.as_ptr = app;
+      slv->stats.rho_retained++;
+    }
+    btor_hashptr_table_delete (rho);
+    btor_node_release (btor, fun);
+  }
+  BTOR_RESET_STACK (slv->rho_funs);
+}
+
+/* Minimum number of assignments queried per thread (see prefetch_assignments).
+ */
+#define BTOR_FUN_PREFETCH_MIN_PER_THREAD 256
+
+struct BtorFunPrefetchWorker
+{
+  BtorMemMgr *mm; /* worker local, memory managers are not thread-safe */
+  BtorNode **nodes;
+  BtorBitVector **bvs;
+  uint32_t num_nodes;
+  uint32_t first;
+  uint32_t step;
+};
+
+typedef struct BtorFunPrefetchWorker BtorFunPrefetchWorker;
+
+static void *
+prefetch_assignments_worker (void *state)
+{
+  uint32_t i;
+  BtorFunPrefetchWorker *w;
+
+  w = state;
+  for (i = w->first; i < w->num_nodes; i += w->step)
+    w->bvs[i] = btor_bv_get_assignment (w->mm, w->nodes[i]);
+  return 0;
+}
+
+static void
+collect_prefetch_node (Btor *btor,
+                       BtorNode *exp,
+                       BtorNodePtrStack *nodes,
+                       BtorIntHashTable *cache)
+{
+  exp = btor_node_real_addr (btor_node_get_simplified (btor, exp));
+  if (!btor_node_is_synth (exp) || btor_node_is_bv_const (exp)
+      || btor_hashint_table_contains (cache, exp->id)
+      || btor_hashint_map_contains (btor->bv_model, exp->id))
+    return;
+  btor_hashint_table_add (cache, exp->id);
+  BTOR_PUSH_STACK (*nodes, exp);
+}
+
+/* Query the assignments of the initial applies and their arguments, which are
+ * the first assignments required for consistency checking, from the SAT
+ * solver in BTOR_OPT_FUN_THREADS threads. Each thread only reads the AIG
+ * vectors of its nodes and the SAT assignment, and uses its own memory
+ * manager. The results are added to 'btor->bv_model' in the order of
+ * 'init_apps', which yields the same model as querying them on demand. */
+static void
+prefetch_assignments (Btor *btor, BtorNodePtrStack *init_apps)
+{
+  assert (btor);
+  assert (btor->slv);
+  assert (btor->slv->kind == BTOR_FUN_SOLVER_KIND);
+  assert (btor->bv_model);
+  assert (init_apps);
+
+  double start;
+  uint32_t i, num_nodes, num_threads;
+  BtorMemMgr *mm;
+  BtorNode *app;
+  BtorNodePtrStack nodes;
+  BtorIntHashTable *cache;
+  BtorArgsIterator it;
+  BtorBitVector **bvs;
+  BtorFunPrefetchWorker *workers;
+#ifdef BTOR_HAVE_PTHREADS
+  pthread_t *threads;
+#endif
+
+  num_threads = btor_opt_get (btor, BTOR_OPT_FUN_THREADS);
+#ifndef BTOR_HAVE_PTHREADS
+  num_threads = 0;
+#endif
+  if (num_threads < 2) return;
+
+  start = btor_util_time_stamp ();
+  mm    = btor->mm;
+  cache = btor_hashint_table_new (mm);
+  BTOR_INIT_STACK (mm, nodes);
+
+  for (i = 0; i < BTOR_COUNT_STACK (*init_apps); i++)
+  {
+    app = BTOR_PEEK_STACK (*init_apps, i);
+    collect_prefetch_node (btor, app, &nodes, cache);
+    btor_iter_args_init (&it, btor_node_get_simplified (btor, app->e[1]));
+    while (btor_iter_args_has_next (&it))
+      collect_prefetch_node (btor, btor_iter_args_next (&it), &nodes, cache);
+  }
+  btor_hashint_table_delete (cache);
+
+  num_nodes = BTOR_COUNT_STACK (nodes);
+  if (num_threads > num_nodes / BTOR_FUN_PREFETCH_MIN_PER_THREAD)
+    num_threads = num_nodes / BTOR_FUN_PREFETCH_MIN_PER_THREAD;
+
+  if (num_threads >= 2)
+  {
+    /* some SAT solvers extend their model lazily on the first query, which
+     * must not happen concurrently */
+    btor_bv_free (mm, get_bv_assignment (btor, BTOR_PEEK_STACK (nodes, 0)));
+
+    BTOR_CNEWN (mm, bvs, num_nodes);
+    BTOR_CNEWN (mm, workers, num_threads);
+    for (i = 0; i < num_threads; i++)
+    {
+      workers[i].mm        = btor_mem_mgr_new ();
+      workers[i].nodes     = nodes.start + 1;
+      workers[i].bvs       = bvs + 1;
+      workers[i].num_nodes = num_nodes - 1;
+      workers[i].first     = i;
+      workers[i].step      = num_threads;
+    }
+
+#ifdef BTOR_HAVE_PTHREADS
+    BTOR_NEWN (mm, threads, num_threads);
+    for (i = 0; i < num_threads; i++)
+      pthread_create (&threads[i], 0, prefetch_assignments_worker, &workers[i]);
+    for (i = 0; i < num_threads; i++) pthread_join (threads[i], 0);
+    BTOR_DELETEN (mm, threads, num_threads);
+#endif
+
+    for (i = 1; i < num_nodes; i++)
+    {
+      btor_model_add_to_bv (
+          btor, btor->bv_model, BTOR_PEEK_STACK (nodes, i), bvs[i]);
+      btor_bv_free (workers[(i - 1) % num_threads].mm, bvs[i]);
+    }
+    for (i = 0; i < num_threads; i++) btor_mem_mgr_delete (workers[i].mm);
+    BTOR_DELETEN (mm, workers, num_threads);
+    BTOR_DELETEN (mm, bvs, num_nodes);
+  }
+  BTOR_RELEASE_STACK (nodes);
+  BTOR_FUN_SOLVER (btor)->time.prefetch += btor_util_time_stamp () - start;
+}
+
 static void
 check_and_resolve_conflicts (Btor *btor,
                              Btor *clone,
@@ -2240,16 +2822,16 @@ check_and_resolve_conflicts (Btor *btor,
   assert (btor->slv->kind == BTOR_FUN_SOLVER_KIND);
 
   double start, start_cleanup;
-  bool found_conflicts;
+  bool found_conflicts, retained;
   int32_t i;
   BtorMemMgr *mm;
   BtorFunSolver *slv;
   BtorNode *app, *cur;
-  BtorNodePtrStack prop_stack;
+  BtorNodePtrStack prop_stack, stale;
   BtorNodePtrStack top_applies;
   BtorPtrHashTable *cleanup_table;
-  BtorIntHashTable *apply_search_cache;
-  BtorPtrHashTableIterator pit;
+  BtorIntHashTable *apply_search_cache, *prev_model;
+  BtorPtrHashTableIterator pit, rit;
   BtorIntHashTableIterator iit;
 
   start           = btor_util_time_stamp ();
@@ -2260,10 +2842,30 @@ check_and_resolve_conflicts (Btor *btor,
                                           (BtorHashPtr) btor_node_hash_by_id,
                                           (BtorCmpPtr) btor_node_compare_by_id);
 
+  /* keep the model of the previous refinement round to determine which
+   * entries of retained rho tables are still valid */
+  prev_model = 0;
+  if (!BTOR_EMPTY_STACK (slv->rho_funs))
+  {
+    prev_model     = btor->bv_model;
+    btor->bv_model = 0;
+  }
+
   /* initialize new bit vector model, which will be constructed while
    * consistency checking. this also deletes the model from the previous run */
   btor_model_init_bv (btor, &btor->bv_model);
 
+  slv->args_cache = btor_hashint_map_new (mm);
+
+  retained = prev_model != 0;
+  if (retained)
+  {
+    update_retained_rho_tables (btor, prev_model, cleanup_table);
+    btor_model_delete_bv (btor, &prev_model);
+  }
+  else
+    delete_retained_rho_tables (slv);
+
   BTOR_INIT_STACK (mm, prop_stack);
   BTOR_INIT_STACK (mm, top_applies);
   apply_search_cache = btor_hashint_table_new (mm);
@@ -2321,6 +2923,7 @@ check_and_resolve_conflicts (Btor *btor,
     BTORLOG (2, "push apply: %s", btor_util_node2string (app));
   }
 
+  prefetch_assignments (btor, init_apps);
   propagate (btor, &prop_stack, cleanup_table, apply_search_cache);
   found_conflicts = BTOR_COUNT_STACK (slv->cur_lemmas) > 0;
 
@@ -2332,6 +2935,33 @@ check_and_resolve_conflicts (Btor *btor,
     found_conflicts = BTOR_COUNT_STACK (slv->cur_lemmas) > 0;
   }
 
+  /* retained applies that were not propagated in this round are don't cares,
+   * remove them from the rho tables used for model generation */
+  if (!found_conflicts && retained)
+  {
+    BTOR_INIT_STACK (mm, stale);
+    btor_iter_hashptr_init (&pit, cleanup_table);
+    while (btor_iter_hashptr_has_next (&pit))
+    {
+      cur = btor_iter_hashptr_next (&pit);
+      if (!btor_node_is_uf (cur) || !cur->rho) continue;
+      btor_iter_hashptr_init (&rit, cur->rho);
+      while (btor_iter_hashptr_has_next (&rit))
+      {
+        app = rit.bucket->data.as_ptr;
+        if (!app->propagated) BTOR_PUSH_STACK (stale, rit.bucket->key);
+        (void) btor_iter_hashptr_next (&rit);
+      }
+      while (!BTOR_EMPTY_STACK (stale))
+        btor_hashptr_table_remove (cur->rho, BTOR_POP_STACK (stale), 0, 0);
+    }
+    BTOR_RELEASE_STACK (stale);
+  }
+
+  /* cached argument assignments are not valid after removing assignments */
+  delete_args_assignments (btor, slv->args_cache);
+  slv->args_cache = 0;
+
   /* applies may have assignments that were not checked for consistency, which
    * is the case when they are not required for deriving SAT (don't care
    * reasoning). hence, we remove those applies from the 'bv_model' as they do
@@ -2368,8 +2998,16 @@ check_and_resolve_conflicts (Btor *btor,
 
       if (found_conflicts)
       {
-        btor_hashptr_table_delete (cur->rho);
-        cur->rho = 0;
+        if (btor_opt_get (btor, BTOR_OPT_FUN_INC_PROP)
+            && btor_node_is_uf (cur) && btor->feqs->count == 0)
+        {
+          BTOR_PUSH_STACK (slv->rho_funs, btor_node_copy (btor, cur));
+        }
+        else
+        {
+          btor_hashptr_table_delete (cur->rho);
+          cur->rho = 0;
+        }
       }
       else
       {
@@ -2405,6 +3043,608 @@ reset_lemma_cache (BtorFunSolver *slv)
                                         (BtorCmpPtr) btor_node_compare_by_id);
 }
 
+/* Set preferred phases of the CNF variables of all encoded bit-vector
+ * variables and applies to their assignment in 'bv_model'. */
+static void
+set_sat_phases (Btor *btor, BtorIntHashTable *bv_model)
+{
+  assert (btor);
+  assert (bv_model);
+
+  uint32_t i, width;
+  int32_t id, lit;
+  BtorNode *var;
+  BtorBitVector *bv;
+  BtorAIG *aig;
+  BtorSATMgr *smgr;
+  BtorIntHashTableIterator it;
+
+  smgr = btor_get_sat_mgr (btor);
+  if (!btor_sat_is_initialized (smgr)) return;
+
+  btor_iter_hashint_init (&it, bv_model);
+  while (btor_iter_hashint_has_next (&it))
+  {
+    bv = (BtorBitVector *) bv_model->data[it.cur_pos].as_ptr;
+    id = btor_iter_hashint_next (&it);
+    /* skip values of inverted nodes */
+    if (id < 0) continue;
+    var = btor_node_get_by_id (btor, id);
+    if (!btor_node_is_bv_var (var) && !btor_node_is_apply (var)) continue;
+    if (!btor_node_is_synth (var)) continue;
+    width = btor_node_bv_get_width (btor, var);
+    assert (width == btor_bv_get_width (bv));
+    for (i = 0; i < width; i++)
+    {
+      aig = var->av->aigs[i];
+      if (btor_aig_is_const (aig)) continue;
+      lit = btor_aig_get_cnf_id (aig);
+      if (!lit) continue;
+      /* aigs[0] is the MSB */
+      btor_sat_phase (smgr, btor_bv_get_bit (bv, width - 1 - i) ? lit : -lit);
+    }
+  }
+}
+
+/* Retire guarded lemmas whose premise was not true in any refinement round of
+ * the last BTOR_OPT_FUN_LEMMA_GC sat calls. Retired lemmas are permanently
+ * disabled by asserting the negation of their activation literal and removed
+ * from the lemma cache, i.e., they are generated again if required. */
+static void
+retire_inactive_lemmas (Btor *btor)
+{
+  assert (btor);
+  assert (btor->slv);
+  assert (btor->slv->kind == BTOR_FUN_SOLVER_KIND);
+
+  uint32_t i, j, limit;
+  BtorFunSolver *slv;
+  BtorFunLemma *l;
+
+  slv   = BTOR_FUN_SOLVER (btor);
+  limit = btor_opt_get (btor, BTOR_OPT_FUN_LEMMA_GC);
+
+  for (i = 0, j = 0; i < BTOR_COUNT_STACK (slv->lgc.lemmas); i++)
+  {
+    l = slv->lgc.lemmas.start + i;
+    if (slv->lgc.calls - l->last_call <= limit)
+    {
+      slv->lgc.lemmas.start[j++] = *l;
+      continue;
+    }
+    btor_insert_unsynthesized_constraint (
+        btor, btor_node_invert (btor_simplify_exp (btor, l->act)));
+    assert (btor_hashptr_table_get (slv->lemmas, l->lemma));
+    btor_hashptr_table_remove (slv->lemmas, l->lemma, 0, 0);
+    btor_node_release (btor, l->lemma);
+    btor_node_release (btor, l->act);
+    btor_node_release (btor, l->guarded);
+    btor_node_release (btor, l->premise);
+    slv->stats.lemmas_retired++;
+  }
+  slv->lgc.lemmas.top = slv->lgc.lemmas.start + j;
+}
+
+/* Count guarded lemmas whose premise is true under the current assignment as
+ * active in the current sat call. */
+static void
+update_lemma_activity (Btor *btor)
+{
+  assert (btor);
+  assert (btor->slv);
+  assert (btor->slv->kind == BTOR_FUN_SOLVER_KIND);
+  assert (btor->bv_model);
+
+  uint32_t i;
+  BtorFunSolver *slv;
+  BtorFunLemma *l;
+  BtorBitVector *bv;
+
+  slv = BTOR_FUN_SOLVER (btor);
+  for (i = 0; i < BTOR_COUNT_STACK (slv->lgc.lemmas); i++)
+  {
+    l  = slv->lgc.lemmas.start + i;
+    bv = get_bv_assignment (btor, l->premise);
+    if (btor_bv_is_true (bv))
+    {
+      l->hits += 1;
+      l->last_call = slv->lgc.calls;
+    }
+    btor_bv_free (btor->mm, bv);
+  }
+}
+
+/* Assume the activation literals of all guarded lemmas in the next SAT call. */
+static void
+assume_lemma_acts (Btor *btor)
+{
+  assert (btor);
+  assert (btor->slv);
+  assert (btor->slv->kind == BTOR_FUN_SOLVER_KIND);
+
+  int32_t lit;
+  uint32_t i;
+  BtorFunSolver *slv;
+  BtorNode *act;
+  BtorAIG *aig;
+  BtorSATMgr *smgr;
+
+  slv  = BTOR_FUN_SOLVER (btor);
+  smgr = btor_get_sat_mgr (btor);
+  for (i = 0; i < BTOR_COUNT_STACK (slv->lgc.lemmas); i++)
+  {
+    act = BTOR_PEEK_STACK (slv->lgc.lemmas, i).act;
+    if (btor_node_is_simplified (act) || !btor_node_is_synth (act)) continue;
+    aig = act->av->aigs[0];
+    if (btor_aig_is_const (aig)) continue;
+    lit = btor_aig_get_cnf_id (aig);
+    if (lit) btor_sat_assume (smgr, lit);
+  }
+}
+
+/* Solver statistics at the beginning of a refinement round, used to compute
+ * the per-round values of the lemmas on demand trace. */
+struct BtorLODTraceRound
+{
+  uint32_t num;
+  BtorSolverResult sat_result;
+  double sat_time;
+  double check_time;
+  uint_least64_t propagations;
+  uint_least64_t beta_reductions;
+  uint32_t fc_conflicts;
+  uint32_t br_conflicts;
+  uint32_t ext_lemmas;
+};
+
+typedef struct BtorLODTraceRound BtorLODTraceRound;
+
+static void
+trace_round_begin (BtorFunSolver *slv, BtorLODTraceRound *round)
+{
+  assert (slv);
+  assert (round);
+
+  Btor *btor;
+
+  btor = slv->btor;
+
+  round->num += 1;
+  round->sat_result   = BTOR_RESULT_UNKNOWN;
+  round->sat_time     = slv->time.sat;
+  round->check_time   = slv->time.check_consistency;
+  round->propagations = slv->stats.propagations;
+  round->beta_reductions =
+      btor->stats.beta_reduce_calls + btor->stats.betap_reduce_calls;
+  round->fc_conflicts = slv->stats.function_congruence_conflicts;
+  round->br_conflicts = slv->stats.beta_reduction_conflicts;
+  round->ext_lemmas   = slv->stats.extensionality_lemmas;
+  BTOR_RESET_STACK (slv->trace.lemma_sizes);
+}
+
+/* Print one JSON record for the current refinement round. */
+static void
+trace_round_end (BtorFunSolver *slv, BtorLODTraceRound *round)
+{
+  assert (slv);
+  assert (round);
+  assert (slv->btor->lod_trace);
+
+  uint32_t i;
+  Btor *btor;
+  FILE *file;
+
+  btor = slv->btor;
+  file = btor->lod_trace;
+
+  fprintf (file,
+           "{\"call\":%u,\"round\":%u,\"result\":\"%s\","
+           "\"sat_time\":%.6f,\"check_time\":%.6f,"
+           "\"propagations\":%llu,\"beta_reductions\":%llu,"
+           "\"congruence_conflicts\":%u,\"beta_conflicts\":%u,"
+           "\"extensionality_lemmas\":%u,\"lemmas\":[",
+           slv->trace.calls,
+           round->num,
+           round->sat_result == BTOR_RESULT_SAT
+               ? "sat"
+               : (round->sat_result == BTOR_RESULT_UNSAT ? "unsat" : "unknown"),
+           slv->time.sat - round->sat_time,
+           slv->time.check_consistency - round->check_time,
+           (unsigned long long) (slv->stats.propagations - round->propagations),
+           (unsigned long long) (btor->stats.beta_reduce_calls
+                                 + btor->stats.betap_reduce_calls
+                                 - round->beta_reductions),
+           slv->stats.function_congruence_conflicts - round->fc_conflicts,
+           slv->stats.beta_reduction_conflicts - round->br_conflicts,
+           slv->stats.extensionality_lemmas - round->ext_lemmas);
+  for (i = 0; i < BTOR_COUNT_STACK (slv->trace.lemma_sizes); i++)
+    fprintf (file,
+             "%s%u",
+             i ? "," : "",
+             BTOR_PEEK_STACK (slv->trace.lemma_sizes, i));
+  fputs ("]}\n", file);
+  fflush (file);
+}
+
+/* Number of propagations (prop) or flips (sls) of a local search run between
+ * two SAT calls (FUN_LS_BURSTS). */
+#define BTOR_FUN_LS_BURST_STEPS 10000
+
+/* Run the prop (FUN_PREPROP) or sls (FUN_PRESLS) engine on the current
+ * formula, bounded by 'limit' propagations (prop) or flips (sls) if 'limit' is
+ * not zero. The search starts from assignment 'best' (if given), which is
+ * replaced with the assignment with the minimum number of unsatisfied roots
+ * found. */
+static BtorSolverResult
+run_local_search (Btor *btor, BtorIntHashTable **best, uint32_t limit)
+{
+  assert (btor);
+  assert (best);
+
+  uint32_t olimit, owarm;
+  BtorOption opt, warm;
+  BtorOptEngine eopt;
+  BtorSolverResult result;
+  BtorSolver *slv, *preslv;
+
+  slv = btor->slv;
+
+  if (btor_opt_get (btor, BTOR_OPT_FUN_PREPROP))
+  {
+    preslv = btor_new_prop_solver (btor);
+    eopt   = BTOR_ENGINE_PROP;
+    opt    = BTOR_OPT_PROP_NPROPS;
+    warm   = BTOR_OPT_PROP_WARM_START;
+    ((BtorPropSolver *) preslv)->best_model = *best;
+  }
+  else
+  {
+    preslv = btor_new_sls_solver (btor);
+    eopt   = BTOR_ENGINE_SLS;
+    opt    = BTOR_OPT_SLS_NFLIPS;
+    warm   = BTOR_OPT_SLS_WARM_START;
+    ((BtorSLSSolver *) preslv)->best_model = *best;
+  }
+  olimit = btor_opt_get (btor, opt);
+  if (limit && (!olimit || olimit > limit)) btor_opt_set (btor, opt, limit);
+  /* keep best assignment after the run */
+  owarm = btor_opt_get (btor, warm);
+  btor_opt_set (btor, warm, 1);
+
+  btor->slv = preslv;
+  btor_opt_set (btor, BTOR_OPT_ENGINE, eopt);
+  result = btor->slv->api.sat (btor->slv);
+  /* print prop/sls solver statistics */
+  btor->slv->api.print_stats (btor->slv);
+  btor->slv->api.print_time_stats (btor->slv);
+  /* take over best assignment and delete prop/sls solver */
+  if (eopt == BTOR_ENGINE_PROP)
+  {
+    *best = ((BtorPropSolver *) preslv)->best_model;
+    ((BtorPropSolver *) preslv)->best_model = 0;
+  }
+  else
+  {
+    *best = ((BtorSLSSolver *) preslv)->best_model;
+    ((BtorSLSSolver *) preslv)->best_model = 0;
+  }
+  btor->slv->api.delet (btor->slv);
+  /* reset */
+  btor->slv = slv;
+  btor_opt_set (btor, BTOR_OPT_ENGINE, BTOR_ENGINE_FUN);
+  btor_opt_set (btor, opt, olimit);
+  btor_opt_set (btor, warm, owarm);
+
+  if (result == BTOR_RESULT_SAT || result == BTOR_RESULT_UNSAT)
+  {
+    BTOR_MSG (btor->msg, 1, "");
+    BTOR_MSG (btor->msg,
+              1,
+              "%s engine determined %s",
+              eopt == BTOR_ENGINE_PROP ? "PROP" : "SLS",
+              result == BTOR_RESULT_SAT ? "'sat'" : "'unsat'");
+  }
+  return result;
+}
+
+/* Translate the formula of 'btor' into a new instance with bit-vector
+ * variables only, for local search with the prop or sls engine. Lambdas
+ * (and thus array writes) are eliminated by full beta reduction on an
+ * expression layer clone, all remaining applications of UFs (and arrays) are
+ * replaced by fresh variables and constrained by Ackermann constraints.
+ * Assumptions are asserted as constraints. Returns 0 if the formula contains
+ * function equalities. 'inputs' maps the ids of the bit-vector variables and
+ * applies of 'btor' to the ids of the corresponding variables of the new
+ * instance. */
+static Btor *
+new_ackermannized_bv_clone (Btor *btor, BtorIntHashTable **inputs)
+{
+  assert (btor);
+  assert (btor->feqs->count == 0);
+  assert (btor->quantifiers->count == 0);
+  assert (inputs);
+
+  uint32_t i, j;
+  bool fail;
+  Btor *clone, *bvbtor;
+  BtorNode *cur, *real_cur, *e[3], *res, *app_i, *app_j, *p, *eq, *tmp;
+  BtorNode *uf;
+  BtorNodeMap *exp_map;
+  BtorNodeIterator nit;
+  BtorArgsIterator ait_i, ait_j;
+  BtorPtrHashTableIterator it;
+  BtorNodePtrStack visit, roots, applies;
+  BtorIntHashTable *mark;
+  BtorHashTableData *d;
+  BtorSortId sort;
+  BtorMemMgr *mm;
+
+  mm      = btor->mm;
+  exp_map = 0;
+  clone   = btor_clone_exp_layer (btor, &exp_map, true);
+  btor_opt_set (clone, BTOR_OPT_BETA_REDUCE, BTOR_BETA_REDUCE_ALL);
+  btor_eliminate_applies (clone);
+
+  bvbtor = btor_new ();
+  btor_opt_delete_opts (bvbtor);
+  btor_opt_clone_opts (btor, bvbtor);
+  btor_set_msg_prefix (bvbtor, "ack");
+  btor_opt_set (bvbtor, BTOR_OPT_MODEL_GEN, 0);
+  bvbtor->cbs.term = btor->cbs.term;
+
+  /* translated nodes of bvbtor by id of clone */
+  mark = btor_hashint_map_new (mm);
+  fail = false;
+  BTOR_INIT_STACK (mm, visit);
+  BTOR_INIT_STACK (mm, roots);
+  btor_iter_hashptr_init (&it, clone->unsynthesized_constraints);
+  btor_iter_hashptr_queue (&it, clone->synthesized_constraints);
+  btor_iter_hashptr_queue (&it, clone->assumptions);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    cur = btor_iter_hashptr_next (&it);
+    BTOR_PUSH_STACK (roots, cur);
+    BTOR_PUSH_STACK (visit, cur);
+  }
+
+  while (!BTOR_EMPTY_STACK (visit))
+  {
+    real_cur = btor_node_real_addr (BTOR_POP_STACK (visit));
+    d        = btor_hashint_map_get (mark, real_cur->id);
+    if (!d)
+    {
+      btor_hashint_map_add (mark, real_cur->id);
+      BTOR_PUSH_STACK (visit, real_cur);
+      /* the function of an apply is not translated */
+      if (btor_node_is_apply (real_cur))
+        BTOR_PUSH_STACK (visit, real_cur->e[1]);
+      else
+        for (i = 0; i < real_cur->arity; i++)
+          BTOR_PUSH_STACK (visit, real_cur->e[i]);
+    }
+    else if (!d->as_ptr && !btor_node_is_args (real_cur))
+    {
+      for (i = 0; i < real_cur->arity; i++)
+      {
+        if (btor_node_is_fun (real_cur->e[i])) continue;
+        if (btor_node_is_args (real_cur->e[i])) continue;
+        d    = btor_hashint_map_get (mark,
+                                      btor_node_real_addr (real_cur->e[i])->id);
+        e[i] = btor_node_cond_invert (real_cur->e[i], d->as_ptr);
+      }
+      switch (real_cur->kind)
+      {
+        case BTOR_BV_CONST_NODE:
+          res = btor_exp_bv_const (bvbtor,
+                                   btor_node_bv_const_get_bits (real_cur));
+          break;
+        case BTOR_VAR_NODE:
+        case BTOR_APPLY_NODE:
+          if (btor_node_is_apply (real_cur)
+              && !btor_node_is_uf (real_cur->e[0]))
+          {
+            fail = true;
+            goto DONE;
+          }
+          sort = btor_sort_bv (bvbtor,
+                               btor_node_bv_get_width (clone, real_cur));
+          res  = btor_exp_var (bvbtor, sort, 0);
+          btor_sort_release (bvbtor, sort);
+          break;
+        case BTOR_BV_SLICE_NODE:
+          res = btor_exp_bv_slice (bvbtor,
+                                   e[0],
+                                   btor_node_bv_slice_get_upper (real_cur),
+                                   btor_node_bv_slice_get_lower (real_cur));
+          break;
+        case BTOR_BV_AND_NODE:
+        case BTOR_BV_EQ_NODE:
+        case BTOR_BV_ADD_NODE:
+        case BTOR_BV_MUL_NODE:
+        case BTOR_BV_ULT_NODE:
+        case BTOR_BV_SLL_NODE:
+        case BTOR_BV_SRL_NODE:
+        case BTOR_BV_UDIV_NODE:
+        case BTOR_BV_UREM_NODE:
+        case BTOR_BV_CONCAT_NODE:
+        case BTOR_COND_NODE:
+          res = btor_exp_create (bvbtor, real_cur->kind, e, real_cur->arity);
+          break;
+        default:
+          /* function equalities, quantifiers */
+          fail = true;
+          goto DONE;
+      }
+      btor_hashint_map_get (mark, real_cur->id)->as_ptr = res;
+    }
+  }
+
+  /* constraints */
+  for (i = 0; i < BTOR_COUNT_STACK (roots); i++)
+  {
+    cur = BTOR_PEEK_STACK (roots, i);
+    res = btor_hashint_map_get (mark, btor_node_real_addr (cur)->id)->as_ptr;
+    btor_assert_exp (bvbtor, btor_node_cond_invert (cur, res));
+  }
+
+  /* Ackermann constraints for all translated applies of a function */
+  btor_iter_hashptr_init (&it, clone->ufs);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    uf = btor_iter_hashptr_next (&it);
+    BTOR_INIT_STACK (mm, applies);
+    btor_iter_apply_parent_init (&nit, uf);
+    while (btor_iter_apply_parent_has_next (&nit))
+    {
+      app_i = btor_iter_apply_parent_next (&nit);
+      if (!btor_hashint_map_contains (mark, app_i->id)) continue;
+      BTOR_PUSH_STACK (applies, app_i);
+    }
+    for (i = 0; i < BTOR_COUNT_STACK (applies); i++)
+    {
+      app_i = BTOR_PEEK_STACK (applies, i);
+      for (j = i + 1; j < BTOR_COUNT_STACK (applies); j++)
+      {
+        app_j = BTOR_PEEK_STACK (applies, j);
+        p     = btor_exp_true (bvbtor);
+        btor_iter_args_init (&ait_i, app_i->e[1]);
+        btor_iter_args_init (&ait_j, app_j->e[1]);
+        while (btor_iter_args_has_next (&ait_i))
+        {
+          e[0] = btor_iter_args_next (&ait_i);
+          e[1] = btor_iter_args_next (&ait_j);
+          e[0] = btor_node_cond_invert (
+              e[0],
+              btor_hashint_map_get (mark, btor_node_real_addr (e[0])->id)
+                  ->as_ptr);
+          e[1] = btor_node_cond_invert (
+              e[1],
+              btor_hashint_map_get (mark, btor_node_real_addr (e[1])->id)
+                  ->as_ptr);
+          eq  = btor_exp_eq (bvbtor, e[0], e[1]);
+          tmp = btor_exp_bv_and (bvbtor, p, eq);
+          btor_node_release (bvbtor, p);
+          btor_node_release (bvbtor, eq);
+          p = tmp;
+        }
+        e[0] = btor_hashint_map_get (mark, app_i->id)->as_ptr;
+        e[1] = btor_hashint_map_get (mark, app_j->id)->as_ptr;
+        eq   = btor_exp_eq (bvbtor, e[0], e[1]);
+        tmp  = btor_exp_implies (bvbtor, p, eq);
+        btor_assert_exp (bvbtor, tmp);
+        btor_node_release (bvbtor, tmp);
+        btor_node_release (bvbtor, eq);
+        btor_node_release (bvbtor, p);
+      }
+    }
+    BTOR_RELEASE_STACK (applies);
+  }
+
+  /* map inputs of btor to variables of bvbtor */
+  *inputs = btor_hashint_map_new (mm);
+  btor_iter_hashptr_init (&it, btor->bv_vars);
+  btor_iter_hashptr_queue (&it, btor->ufs);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    cur = btor_iter_hashptr_next (&it);
+    if (btor_node_is_simplified (cur)) continue;
+    BTOR_PUSH_STACK (visit, cur);
+  }
+  while (!BTOR_EMPTY_STACK (visit))
+  {
+    cur = BTOR_POP_STACK (visit);
+    if (btor_node_is_uf (cur))
+    {
+      btor_iter_apply_parent_init (&nit, cur);
+      while (btor_iter_apply_parent_has_next (&nit))
+      {
+        app_i = btor_iter_apply_parent_next (&nit);
+        if (!app_i->parameterized && !btor_node_is_simplified (app_i))
+          BTOR_PUSH_STACK (visit, app_i);
+      }
+      continue;
+    }
+    real_cur = btor_nodemap_mapped (exp_map, cur);
+    if (!real_cur) continue;
+    real_cur = btor_node_get_simplified (clone, real_cur);
+    if (btor_node_is_inverted (real_cur)) continue;
+    if (!btor_node_is_bv_var (real_cur) && !btor_node_is_apply (real_cur))
+      continue;
+    if (!(d = btor_hashint_map_get (mark, real_cur->id)) || !d->as_ptr)
+      continue;
+    btor_hashint_map_add (*inputs, cur->id)->as_int =
+        btor_node_get_id (d->as_ptr);
+  }
+
+DONE:
+  for (i = 0; i < mark->size; i++)
+  {
+    if (!mark->data[i].as_ptr) continue;
+    btor_node_release (bvbtor, mark->data[i].as_ptr);
+  }
+  btor_hashint_map_delete (mark);
+  BTOR_RELEASE_STACK (visit);
+  BTOR_RELEASE_STACK (roots);
+  btor_nodemap_delete (exp_map);
+  btor_delete (clone);
+  if (fail)
+  {
+    btor_delete (bvbtor);
+    bvbtor = 0;
+  }
+  return bvbtor;
+}
+
+/* Run the prop or sls engine on the Ackermannized bit-vector abstraction of a
+ * formula with UFs and arrays (see new_ackermannized_bv_clone). Since the
+ * abstraction is equisatisfiable, 'unsat' is final. The best assignment of the
+ * abstraction (a satisfying assignment if the result is 'sat') is mapped back
+ * to the bit-vector variables and applies of 'btor' in 'best'. */
+static BtorSolverResult
+run_local_search_ackermannized (Btor *btor, BtorIntHashTable **best)
+{
+  assert (btor);
+  assert (best);
+  assert (!*best);
+
+  int32_t id;
+  Btor *bvbtor;
+  BtorNode *exp;
+  BtorSolverResult result;
+  BtorIntHashTable *inputs, *bvbest;
+  BtorIntHashTableIterator it;
+  BtorHashTableData *d;
+
+  inputs = 0;
+  bvbest = 0;
+  bvbtor = new_ackermannized_bv_clone (btor, &inputs);
+  if (!bvbtor) return BTOR_RESULT_UNKNOWN;
+
+  result = BTOR_RESULT_UNKNOWN;
+  if (!bvbtor->inconsistent)
+    result = run_local_search (bvbtor, &bvbest, 0);
+  else
+    result = BTOR_RESULT_UNSAT;
+
+  if (bvbest)
+  {
+    btor_model_init_bv (btor, best);
+    btor_iter_hashint_init (&it, inputs);
+    while (btor_iter_hashint_has_next (&it))
+    {
+      d   = &inputs->data[it.cur_pos];
+      exp = btor_node_get_by_id (btor, btor_iter_hashint_next (&it));
+      id  = d->as_int;
+      if ((d = btor_hashint_map_get (bvbest, id)))
+        btor_model_add_to_bv (btor, *best, exp, d->as_ptr);
+    }
+    btor_model_delete_bv (bvbtor, &bvbest);
+  }
+  btor_hashint_map_delete (inputs);
+  btor_delete (bvbtor);
+  return result;
+}
+
 static BtorSolverResult
 sat_fun_solver (BtorFunSolver *slv)
 {
@@ -2414,17 +3654,22 @@ sat_fun_solver (BtorFunSolver *slv)
   assert (slv->btor->slv == (BtorSolver *) slv);
 
   uint32_t i;
-  bool done;
+  int32_t ls_limit;
   BtorSolverResult result;
   Btor *btor, *clone;
   BtorNode *clone_root, *lemma;
   BtorNodeMap *exp_map;
-  BtorIntHashTable *init_apps_cache;
+  BtorIntHashTable *init_apps_cache, *ls_model;
   BtorNodePtrStack init_apps;
+  BtorLODTraceRound round;
 
   btor = slv->btor;
   assert (!btor->inconsistent);
 
+  round.num = 0;
+  if (btor->lod_trace) slv->trace.calls += 1;
+  slv->lgc.calls += 1;
+
   /* make initial applies in bv skeleton global in order to prevent
    * traversing the whole formula every refinement round */
   BTOR_INIT_STACK (btor->mm, init_apps);
@@ -2433,51 +3678,39 @@ sat_fun_solver (BtorFunSolver *slv)
   clone      = 0;
   clone_root = 0;
   exp_map    = 0;
+  ls_model   = 0;
+  ls_limit   = 0;
 
   if ((btor_opt_get (btor, BTOR_OPT_FUN_PREPROP)
        || btor_opt_get (btor, BTOR_OPT_FUN_PRESLS))
       && btor->ufs->count == 0 && btor->feqs->count == 0
       && btor->lambdas->count == 0)
   {
-    BtorSolver *preslv;
-    BtorOptEngine eopt;
-
-    if (btor_opt_get (btor, BTOR_OPT_FUN_PREPROP))
-    {
-      preslv = btor_new_prop_solver (btor);
-      eopt   = BTOR_ENGINE_PROP;
-    }
-    else
-    {
-      preslv = btor_new_sls_solver (btor);
-      eopt   = BTOR_ENGINE_SLS;
-    }
-
-    btor->slv = preslv;
-    btor_opt_set (btor, BTOR_OPT_ENGINE, eopt);
-    result = btor->slv->api.sat (btor->slv);
-    done   = result == BTOR_RESULT_SAT || result == BTOR_RESULT_UNSAT;
-    /* print prop/sls solver statistics */
-    btor->slv->api.print_stats (btor->slv);
-    btor->slv->api.print_time_stats (btor->slv);
-    /* delete prop/sls solver */
-    btor->slv->api.delet (btor->slv);
-    /* reset */
-    btor->slv = (BtorSolver *) slv;
-    btor_opt_set (btor, BTOR_OPT_ENGINE, BTOR_ENGINE_FUN);
-    if (done)
-    {
-      BTOR_MSG (btor->msg, 1, "");
-      BTOR_MSG (btor->msg,
-                1,
-                "%s engine determined %s",
-                eopt == BTOR_ENGINE_PROP ? "PROP" : "SLS",
-                result == BTOR_RESULT_SAT ? "'sat'" : "'unsat'");
-      goto DONE;
-    }
+    result = run_local_search (btor, &ls_model, 0);
+    if (result == BTOR_RESULT_SAT || result == BTOR_RESULT_UNSAT) goto DONE;
+    /* keep best assignment of prop/sls engine to seed phases of SAT solver
+     * and as starting point for prop/sls runs between SAT calls */
     /* reset */
     btor_model_delete (btor);
   }
+  else if ((btor_opt_get (btor, BTOR_OPT_FUN_PREPROP)
+            || btor_opt_get (btor, BTOR_OPT_FUN_PRESLS))
+           && btor->feqs->count == 0 && btor->quantifiers->count == 0)
+  {
+    /* local search on the Ackermannized bit-vector abstraction, its best
+     * assignment seeds the phases of the SAT solver */
+    result = run_local_search_ackermannized (btor, &ls_model);
+    if (result == BTOR_RESULT_UNSAT) goto DONE;
+  }
+
+  if (btor_opt_get (btor, BTOR_OPT_CUBE_THREADS) && btor->ufs->count == 0
+      && btor->feqs->count == 0 && btor->lambdas->count == 0
+      && btor->quantifiers->count == 0
+      && !btor_opt_get (btor, BTOR_OPT_PRINT_DIMACS))
+  {
+    result = btor_cube_and_conquer (btor);
+    if (result != BTOR_RESULT_UNKNOWN) goto DONE;
+  }
 
   if (btor_terminate (btor))
   {
@@ -2488,14 +3721,33 @@ sat_fun_solver (BtorFunSolver *slv)
 
   configure_sat_mgr (btor);
 
+  if (ls_model && slv->sat_limit == -1 && use_ls_bursts (btor))
+    ls_limit = BTOR_MIN_UTIL (btor_opt_get (btor, BTOR_OPT_FUN_LS_BURSTS),
+                              INT32_MAX);
+
   if (slv->assume_lemmas) reset_lemma_cache (slv);
 
+  if (!BTOR_EMPTY_STACK (slv->lgc.lemmas)) retire_inactive_lemmas (btor);
+
   if (btor->feqs->count > 0) add_function_inequality_constraints (btor);
 
-  /* initialize dual prop clone */
+  /* initialize dual prop clone, or add new constraints if it was already
+   * created in a previous sat call */
   if (btor_opt_get (btor, BTOR_OPT_FUN_DUAL_PROP))
   {
-    clone = new_exp_layer_clone_for_dual_prop (btor, &exp_map, &clone_root);
+    if (!slv->dp.clone)
+    {
+      slv->dp.clone = new_exp_layer_clone_for_dual_prop (
+          btor, &slv->dp.exp_map, &slv->dp.root);
+    }
+    else
+    {
+      slv->stats.dp_clone_reuses += 1;
+      add_constraints_to_dual_prop_clone (btor);
+    }
+    clone   = slv->dp.clone;
+    exp_map = slv->dp.exp_map;
+    if (clone) clone_root = dual_prop_clone_root (btor);
   }
 
   while (true)
@@ -2507,6 +3759,12 @@ sat_fun_solver (BtorFunSolver *slv)
       goto UNKNOWN;
     }
 
+    if (btor->lod_trace)
+    {
+      if (round.num) trace_round_end (slv, &round);
+      trace_round_begin (slv, &round);
+    }
+
     btor_process_unsynthesized_constraints (btor);
     if (btor->found_constraint_false)
     {
@@ -2518,9 +3776,31 @@ sat_fun_solver (BtorFunSolver *slv)
     assert (btor_dbg_check_all_hash_tables_proxy_free (btor));
     assert (btor_dbg_check_all_hash_tables_simp_free (btor));
 
+    if (ls_model)
+    {
+      if (btor_opt_get (btor, BTOR_OPT_FUN_PHASES))
+        set_sat_phases (btor, ls_model);
+      if (!ls_limit) btor_model_delete_bv (btor, &ls_model);
+    }
+
     /* make SAT call on bv skeleton */
     btor_add_again_assumptions (btor);
-    result = timed_sat_sat (btor, slv->sat_limit);
+    assume_lemma_acts (btor);
+    result = timed_sat_sat (btor, ls_limit ? ls_limit : slv->sat_limit);
+    round.sat_result = result;
+
+    if (result == BTOR_RESULT_UNKNOWN && ls_limit && !btor_terminate (btor))
+    {
+      /* SAT call hit its limit, continue local search from the best
+       * assignment found so far for a bounded number of steps */
+      slv->stats.ls_bursts += 1;
+      result = run_local_search (btor, &ls_model, BTOR_FUN_LS_BURST_STEPS);
+      if (result == BTOR_RESULT_SAT || result == BTOR_RESULT_UNSAT) goto DONE;
+      btor_model_delete (btor);
+      /* geometrically increase the limit of the SAT solver */
+      ls_limit = ls_limit > INT32_MAX / 2 ? 0 : 2 * ls_limit;
+      continue;
+    }
 
     if (result == BTOR_RESULT_UNSAT)
       goto DONE;
@@ -2540,6 +3820,9 @@ sat_fun_solver (BtorFunSolver *slv)
     if (BTOR_EMPTY_STACK (slv->cur_lemmas)) break;
     slv->stats.refinement_iterations++;
 
+    /* model of this round is discarded in the next round */
+    update_lemma_activity (btor);
+
     BTORLOG (1, "add %d lemma(s)", BTOR_COUNT_STACK (slv->cur_lemmas));
     /* add generated lemmas to formula */
     for (i = 0; i < BTOR_COUNT_STACK (slv->cur_lemmas); i++)
@@ -2552,7 +3835,13 @@ sat_fun_solver (BtorFunSolver *slv)
       else
         btor_insert_unsynthesized_constraint (btor, lemma);
       if (clone)
-        add_lemma_to_dual_prop_clone (btor, clone, &clone_root, lemma, exp_map);
+        add_lemma_to_dual_prop_clone (
+            btor, clone, &slv->dp.root, lemma, exp_map);
+    }
+    if (clone)
+    {
+      btor_node_release (clone, clone_root);
+      clone_root = dual_prop_clone_root (btor);
     }
     BTOR_RESET_STACK (slv->cur_lemmas);
 
@@ -2574,15 +3863,21 @@ sat_fun_solver (BtorFunSolver *slv)
   }
 
 DONE:
+  if (round.num)
+  {
+    /* the last round may end without SAT call (constraints became false) */
+    round.sat_result = result;
+    trace_round_end (slv, &round);
+  }
+  delete_retained_rho_tables (slv);
   BTOR_RELEASE_STACK (init_apps);
   btor_hashint_table_delete (init_apps_cache);
+  if (ls_model) btor_model_delete_bv (btor, &ls_model);
 
-  if (clone)
+  if (clone_root)
   {
-    assert (exp_map);
-    btor_nodemap_delete (exp_map);
+    assert (clone);
     btor_node_release (clone, clone_root);
-    btor_delete (clone);
   }
   return result;
 }
@@ -2599,8 +3894,12 @@ generate_model_fun_solver (BtorFunSolver *slv,
   assert (slv->btor);
   assert (slv->btor->slv == (BtorSolver *) slv);
 
+  double start;
+
   (void) reset;
 
+  start = btor_util_time_stamp ();
+
   /* already created during check_and_resolve_conflicts */
   if (!slv->btor->bv_model)
     btor_model_init_bv (slv->btor, &slv->btor->bv_model);
@@ -2610,6 +3909,15 @@ generate_model_fun_solver (BtorFunSolver *slv,
                        slv->btor->bv_model,
                        slv->btor->fun_model,
                        model_for_all_nodes);
+
+  if (slv->btor->lod_trace)
+  {
+    fprintf (slv->btor->lod_trace,
+             "{\"call\":%u,\"model_time\":%.6f}\n",
+             slv->trace.calls,
+             btor_util_time_stamp () - start);
+    fflush (slv->btor->lod_trace);
+  }
 }
 
 static void
@@ -2677,6 +3985,23 @@ print_stats_fun_solver (BtorFunSolver *slv)
   BTOR_MSG (btor->msg, 1, "%7lld propagations", slv->stats.propagations);
   BTOR_MSG (
       btor->msg, 1, "%7lld propagations down", slv->stats.propagations_down);
+  if (btor_opt_get (btor, BTOR_OPT_FUN_LEMMA_GC))
+    BTOR_MSG (btor->msg,
+              1,
+              "%d/%d guarded lemmas active/retired",
+              BTOR_COUNT_STACK (slv->lgc.lemmas),
+              slv->stats.lemmas_retired);
+  if (btor_opt_get (btor, BTOR_OPT_FUN_WEQ_LEMMAS))
+    BTOR_MSG (btor->msg,
+              1,
+              "%7lld lemma premisses removed via weak equivalence",
+              slv->stats.weq_removed);
+  if (btor_opt_get (btor, BTOR_OPT_FUN_INC_PROP))
+    BTOR_MSG (btor->msg,
+              1,
+              "%7lld/%lld rho entries retained/dropped",
+              slv->stats.rho_retained,
+              slv->stats.rho_dropped);
 
   if (btor_opt_get (btor, BTOR_OPT_FUN_DUAL_PROP))
   {
@@ -2690,7 +4015,17 @@ print_stats_fun_solver (BtorFunSolver *slv)
               "%d/%d dual prop. applies (failed/assumed)",
               slv->stats.dp_failed_applies,
               slv->stats.dp_assumed_applies);
+    BTOR_MSG (btor->msg,
+              1,
+              "%d/%d dual prop. clone reuses/added constraints",
+              slv->stats.dp_clone_reuses,
+              slv->stats.dp_clone_constraints);
   }
+  if (slv->stats.ls_bursts)
+    BTOR_MSG (btor->msg,
+              1,
+              "%d prop/sls runs between SAT calls",
+              slv->stats.ls_bursts);
 }
 
 static void
@@ -2752,6 +4087,11 @@ print_time_stats_fun_solver (BtorFunSolver *slv)
               slv->time.search_init_apps_collect_fa_cone);
   }
 
+  if (btor_opt_get (btor, BTOR_OPT_FUN_THREADS) > 1)
+    BTOR_MSG (btor->msg,
+              1,
+              "  %.2f seconds assignment prefetching",
+              slv->time.prefetch);
   BTOR_MSG (btor->msg, 1, "  %.2f seconds propagation", slv->time.prop);
   BTOR_MSG (
       btor->msg, 1, "    %.2f seconds expression evaluation", slv->time.eval);
@@ -2817,6 +4157,9 @@ btor_new_fun_solver (Btor *btor)
                                         (BtorHashPtr) btor_node_hash_by_id,
                                         (BtorCmpPtr) btor_node_compare_by_id);
   BTOR_INIT_STACK (btor->mm, slv->cur_lemmas);
+  BTOR_INIT_STACK (btor->mm, slv->rho_funs);
+  BTOR_INIT_STACK (btor->mm, slv->trace.lemma_sizes);
+  BTOR_INIT_STACK (btor->mm, slv->lgc.lemmas);
 
   BTOR_INIT_STACK (btor->mm, slv->stats.lemmas_size);
 
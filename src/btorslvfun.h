@@ -11,10 +11,28 @@
 
 #include "btornode.h"
 #include "btorslv.h"
+#include "utils/btorhashint.h"
 #include "utils/btorhashptr.h"
+#include "utils/btornodemap.h"
+#include "utils/btorstack.h"
 
 #define BTOR_FUN_SOLVER(btor) ((BtorFunSolver *) (btor)->slv)
 
+/* Lemma guarded by an activation literal (see BTOR_OPT_FUN_LEMMA_GC). */
+struct BtorFunLemma
+{
+  BtorNode *lemma;    /* lemma as stored in the lemma cache */
+  BtorNode *act;      /* activation literal */
+  BtorNode *guarded;  /* act -> lemma */
+  BtorNode *premise;  /* premise of lemma */
+  uint32_t hits;      /* number of rounds in which the premise was true */
+  uint32_t last_call; /* last sat call in which the premise was true */
+};
+
+typedef struct BtorFunLemma BtorFunLemma;
+
+BTOR_DECLARE_STACK (BtorFunLemma, BtorFunLemma);
+
 struct BtorFunSolver
 {
   BTOR_SOLVER_STRUCT;
@@ -29,6 +47,34 @@ struct BtorFunSolver
   int32_t sat_limit;
   bool assume_lemmas;
 
+  /* lemmas on demand trace (if btor->lod_trace is set) */
+  struct
+  {
+    uint32_t calls;            /* number of sat calls */
+    BtorUIntStack lemma_sizes; /* sizes of lemmas added in current round */
+  } trace;
+
+  /* guarded lemmas subject to lemma garbage collection */
+  struct
+  {
+    BtorFunLemmaStack lemmas;
+    uint32_t calls; /* number of sat calls */
+  } lgc;
+
+  /* args id -> assignment of arguments, valid during consistency checking */
+  BtorIntHashTable *args_cache;
+
+  /* UFs with rho tables retained for the next refinement round */
+  BtorNodePtrStack rho_funs;
+
+  /* dual propagation clone, kept alive across refinements and sat calls */
+  struct
+  {
+    Btor *clone;
+    BtorNode *root; /* conjunction of constraints and lemmas */
+    BtorNodeMap *exp_map;
+  } dp;
+
   struct
   {
     uint32_t lod_refinements; /* number of lemmas on demand refinements */
@@ -40,6 +86,8 @@ struct BtorFunSolver
 
     BtorUIntStack lemmas_size;      /* distribution of n-size lemmas */
     uint_least64_t lemmas_size_sum; /* sum of the size of all added lemmas */
+    uint_least64_t weq_removed;     /* premisses removed via weak eq. */
+    uint32_t lemmas_retired;        /* lemmas retired via lemma gc */
 
     uint32_t dp_failed_vars; /* number of vars in FA (dual prop) of last
                                 sat call (final bv skeleton) */
@@ -49,10 +97,15 @@ struct BtorFunSolver
     uint32_t dp_assumed_applies;
     uint32_t dp_failed_eqs;
     uint32_t dp_assumed_eqs;
+    uint32_t dp_clone_reuses;      /* sat calls reusing the dual prop clone */
+    uint32_t dp_clone_constraints; /* constraints added to existing clone */
+    uint32_t ls_bursts;            /* prop/sls runs between SAT calls */
 
     uint_least64_t eval_exp_calls;
     uint_least64_t propagations;
     uint_least64_t propagations_down;
+    uint_least64_t rho_retained; /* rho entries kept across refinements */
+    uint_least64_t rho_dropped;  /* rho entries dropped due to new model */
   } stats;
 
   struct
@@ -75,6 +128,7 @@ struct BtorFunSolver
     double find_conf_app;
     double check_extensionality;
     double prop_cleanup;
+    double prefetch;
   } time;
 };
 
@@ -24,10 +24,15 @@
 
 #include "utils/btorhashint.h"
 #include "utils/btorhashptr.h"
+#include "utils/btorstack.h"
 #include "utils/btorutil.h"
 
 #include <math.h>
 
+#ifdef BTOR_HAVE_PTHREADS
+#include <pthread.h>
+#endif
+
 /*------------------------------------------------------------------------*/
 
 #define BTOR_PROP_MAXSTEPS_CFACT 100
@@ -36,6 +41,8 @@
 
 #define BTOR_PROP_SELECT_CFACT 20
 
+#define BTOR_PROP_ADAPTIVE_CFACT 2
+
 /*------------------------------------------------------------------------*/
 
 static BtorNode *
@@ -188,6 +195,83 @@ move (Btor *btor, uint32_t nmoves)
 
 /*------------------------------------------------------------------------*/
 
+/* Set the options according to configuration 'config' (see prop-adaptive).
+ * Every bit of 'config' enables the variation of one option w.r.t. its
+ * user value: bit 0 switches path selection (essential/random), bit 1 uses
+ * a tenfold probability for consistent values, and bits 2 and 3 use
+ * probability 1/2 for flipping the condition of ITEs and for flipping bits
+ * of the current assignment of slice operands. Configuration 0 restores the
+ * user values. */
+static void
+set_adaptive_config (Btor *btor, uint32_t config)
+{
+  assert (btor);
+  assert (config < BTOR_PROP_NCONFIGS);
+
+  uint32_t prob;
+  BtorPropSolver *slv;
+
+  slv = BTOR_PROP_SOLVER (btor);
+  assert (slv);
+
+  slv->adaptive.cur = config;
+
+  btor_opt_set (btor,
+                BTOR_OPT_PROP_PATH_SEL,
+                !(config & 1) ? slv->adaptive.path_sel
+                : slv->adaptive.path_sel == BTOR_PROP_PATH_SEL_RANDOM
+                    ? BTOR_PROP_PATH_SEL_ESSENTIAL
+                    : BTOR_PROP_PATH_SEL_RANDOM);
+
+  prob = slv->adaptive.prob_use_inv_value;
+  if (config & 2)
+  {
+    prob = BTOR_PROB_MAX - prob;
+    prob = prob * 10 > BTOR_PROB_MAX ? 0 : BTOR_PROB_MAX - prob * 10;
+  }
+  btor_opt_set (btor, BTOR_OPT_PROP_PROB_USE_INV_VALUE, prob);
+
+  btor_opt_set (btor,
+                BTOR_OPT_PROP_PROB_FLIP_COND,
+                config & 4 ? BTOR_PROB_MAX / 2 : slv->adaptive.prob_flip_cond);
+  btor_opt_set (btor,
+                BTOR_OPT_PROP_PROB_SLICE_FLIP,
+                config & 8 ? BTOR_PROB_MAX / 2 : slv->adaptive.prob_slice_flip);
+}
+
+/* Select configuration for the next restart (UCB1). Configurations are
+ * rewarded with the relative reduction of unsatisfied roots during the
+ * restarts they were selected for. */
+static uint32_t
+select_adaptive_config (BtorPropSolver *slv)
+{
+  assert (slv);
+
+  uint32_t i, n, res;
+  double value, max_value;
+
+  for (i = 0, n = 0; i < BTOR_PROP_NCONFIGS; i++)
+  {
+    if (!slv->adaptive.nselected[i]) return i;
+    n += slv->adaptive.nselected[i];
+  }
+
+  for (i = 0, res = 0, max_value = 0.0; i < BTOR_PROP_NCONFIGS; i++)
+  {
+    value = slv->adaptive.reward[i] / slv->adaptive.nselected[i]
+            + sqrt (BTOR_PROP_ADAPTIVE_CFACT * log (n)
+                    / slv->adaptive.nselected[i]);
+    if (value > max_value)
+    {
+      res       = i;
+      max_value = value;
+    }
+  }
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
 static BtorPropSolver *
 clone_prop_solver (Btor *clone, BtorPropSolver *slv, BtorNodeMap *exp_map)
 {
@@ -206,6 +290,10 @@ clone_prop_solver (Btor *clone, BtorPropSolver *slv, BtorNodeMap *exp_map)
   res->roots = btor_hashint_map_clone (clone->mm, slv->roots, 0, 0);
   res->score =
       btor_hashint_map_clone (clone->mm, slv->score, btor_clone_data_as_dbl, 0);
+  /* start with an empty inverse value cache */
+  res->inv_cache = 0;
+  /* best assignment is not cloned */
+  res->best_model = 0;
 
   return res;
 }
@@ -220,6 +308,9 @@ delete_prop_solver (BtorPropSolver *slv)
 
   if (slv->score) btor_hashint_map_delete (slv->score);
   if (slv->roots) btor_hashint_map_delete (slv->roots);
+  if (slv->inv_cache)
+    btor_proputils_delete_inv_cache (slv->btor->mm, slv->inv_cache);
+  if (slv->best_model) btor_model_delete_bv (slv->btor, &slv->best_model);
 
   BTOR_DELETE (slv->btor->mm, slv);
 }
@@ -235,9 +326,10 @@ sat_prop_solver_aux (Btor *btor)
 {
   assert (btor);
 
+  bool adaptive;
   uint32_t j, max_steps;
   int32_t sat_result;
-  uint32_t nmoves, nprops;
+  uint32_t nmoves, nprops, nroots, min_nroots;
   BtorNode *root;
   BtorPtrHashTableIterator it;
   BtorPropSolver *slv;
@@ -246,7 +338,21 @@ sat_prop_solver_aux (Btor *btor)
   assert (slv);
   nprops = btor_opt_get (btor, BTOR_OPT_PROP_NPROPS);
 
-  nmoves = 0;
+  nmoves = nroots = min_nroots = 0;
+
+  /* configurations can only be varied across restarts */
+  adaptive = btor_opt_get (btor, BTOR_OPT_PROP_ADAPTIVE)
+             && btor_opt_get (btor, BTOR_OPT_PROP_USE_RESTARTS);
+  if (adaptive)
+  {
+    slv->adaptive.path_sel = btor_opt_get (btor, BTOR_OPT_PROP_PATH_SEL);
+    slv->adaptive.prob_use_inv_value =
+        btor_opt_get (btor, BTOR_OPT_PROP_PROB_USE_INV_VALUE);
+    slv->adaptive.prob_flip_cond =
+        btor_opt_get (btor, BTOR_OPT_PROP_PROB_FLIP_COND);
+    slv->adaptive.prob_slice_flip =
+        btor_opt_get (btor, BTOR_OPT_PROP_PROB_SLICE_FLIP);
+  }
 
   /* check for constraints occurring in both phases */
   btor_iter_hashptr_init (&it, btor->assumptions);
@@ -293,6 +399,9 @@ sat_prop_solver_aux (Btor *btor)
       goto DONE;
     }
 
+    btor_lsutils_update_best_model (
+        btor, slv->roots, &slv->best_model, &slv->best_nroots);
+
     /* all constraints sat? */
     if (!slv->roots->count) goto SAT;
 
@@ -302,6 +411,11 @@ sat_prop_solver_aux (Btor *btor)
           btor, btor->bv_model, btor->fun_model, slv->score);
 
     /* init */
+    if (adaptive)
+    {
+      set_adaptive_config (btor, select_adaptive_config (slv));
+      nroots = min_nroots = slv->roots->count;
+    }
     slv->flip_cond_const_prob =
         btor_opt_get (btor, BTOR_OPT_PROP_PROB_FLIP_COND_CONST);
     slv->flip_cond_const_prob_delta =
@@ -322,12 +436,21 @@ sat_prop_solver_aux (Btor *btor)
 
       if (!(move (btor, nmoves))) goto UNSAT;
       nmoves += 1;
+      btor_lsutils_update_best_model (
+          btor, slv->roots, &slv->best_model, &slv->best_nroots);
+      if (slv->roots->count < min_nroots) min_nroots = slv->roots->count;
 
       /* all constraints sat? */
       if (!slv->roots->count) goto SAT;
     }
 
     /* restart */
+    if (adaptive)
+    {
+      slv->adaptive.nselected[slv->adaptive.cur] += 1;
+      slv->adaptive.reward[slv->adaptive.cur] +=
+          (double) (nroots - min_nroots) / nroots;
+    }
     slv->api.generate_model ((BtorSolver *) slv, false, true);
     btor_hashint_map_delete (slv->roots);
     slv->roots = 0;
@@ -357,9 +480,253 @@ DONE:
     btor_hashint_map_delete (slv->score);
     slv->score = 0;
   }
+  if (adaptive) set_adaptive_config (btor, 0);
   return sat_result;
 }
 
+/*------------------------------------------------------------------------*/
+
+#ifdef BTOR_HAVE_PTHREADS
+
+typedef struct BtorPropContext BtorPropContext;
+
+struct BtorPropWalker
+{
+  BtorPropContext *ctx;
+  Btor *clone;
+  BtorSolverResult result;
+};
+typedef struct BtorPropWalker BtorPropWalker;
+
+struct BtorPropContext
+{
+  bool done;              /* result determined */
+  BtorPropWalker *winner; /* walker that determined the result */
+  pthread_mutex_t mutex;
+};
+
+static int32_t
+terminate_walker (void *state)
+{
+  BtorPropContext *ctx = state;
+  return ctx->done;
+}
+
+/* Create clone of 'btor' for walker 'i'. Walker 0 uses the options of 'btor',
+ * all others use a different seed, and are further diversified w.r.t. path
+ * selection and the probability for inverse values. */
+static Btor *
+new_walker_clone (Btor *btor, BtorPropContext *ctx, uint32_t i)
+{
+  uint32_t j, prob;
+  Btor *clone;
+  BtorNode *cur;
+  BtorNodePtrStack assumptions;
+  BtorPtrHashTableIterator it;
+
+  clone = btor_clone_formula (btor);
+  btor_set_term (clone, terminate_walker, ctx);
+  btor_opt_set (clone, BTOR_OPT_PROP_THREADS, 0);
+  btor_opt_set (clone, BTOR_OPT_MODEL_GEN, 1);
+  btor_opt_set (clone, BTOR_OPT_INCREMENTAL, 1);
+  btor_opt_set (clone, BTOR_OPT_CHK_MODEL, 0);
+  btor_opt_set (clone, BTOR_OPT_CHK_UNCONSTRAINED, 0);
+  btor_opt_set (clone, BTOR_OPT_VERBOSITY, 0);
+
+  if (i > 0)
+  {
+    btor_opt_set (clone, BTOR_OPT_SEED, btor_opt_get (btor, BTOR_OPT_SEED) + i);
+    if (i & 1)
+      btor_opt_set (clone,
+                    BTOR_OPT_PROP_PATH_SEL,
+                    btor_opt_get (btor, BTOR_OPT_PROP_PATH_SEL)
+                            == BTOR_PROP_PATH_SEL_RANDOM
+                        ? BTOR_PROP_PATH_SEL_ESSENTIAL
+                        : BTOR_PROP_PATH_SEL_RANDOM);
+    if (i & 2)
+    {
+      /* tenfold probability for consistent values */
+      prob = BTOR_PROB_MAX
+             - btor_opt_get (btor, BTOR_OPT_PROP_PROB_USE_INV_VALUE);
+      prob = prob * 10 > BTOR_PROB_MAX ? 0 : BTOR_PROB_MAX - prob * 10;
+      btor_opt_set (clone, BTOR_OPT_PROP_PROB_USE_INV_VALUE, prob);
+    }
+  }
+
+  /* assumptions of the current SAT call are fixed for the walker */
+  BTOR_INIT_STACK (clone->mm, assumptions);
+  btor_iter_hashptr_init (&it, clone->assumptions);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    cur = btor_iter_hashptr_next (&it);
+    BTOR_PUSH_STACK (assumptions, btor_node_copy (clone, cur));
+  }
+  btor_reset_assumptions (clone);
+  for (j = 0; j < BTOR_COUNT_STACK (assumptions); j++)
+  {
+    cur = BTOR_PEEK_STACK (assumptions, j);
+    btor_assert_exp (clone, cur);
+    btor_node_release (clone, cur);
+  }
+  BTOR_RELEASE_STACK (assumptions);
+  return clone;
+}
+
+static void *
+run_walker (void *state)
+{
+  BtorPropWalker *walker;
+  BtorPropContext *ctx;
+
+  walker         = state;
+  ctx            = walker->ctx;
+  walker->result = btor_check_sat (walker->clone, -1, -1);
+
+  pthread_mutex_lock (&ctx->mutex);
+  if (walker->result != BTOR_RESULT_UNKNOWN && !ctx->done)
+  {
+    ctx->done   = true;
+    ctx->winner = walker;
+  }
+  pthread_mutex_unlock (&ctx->mutex);
+  return 0;
+}
+
+/* Transfer assignments of all bit-vector variables from the clone of the
+ * walker that found a model to 'btor' and compute the model values of all
+ * other nodes from these assignments. */
+static void
+transfer_model (Btor *btor, Btor *clone)
+{
+  BtorNode *var, *cvar;
+  BtorPtrHashTableIterator it;
+  const BtorBitVector *bv;
+
+  btor_model_init_bv (btor, &btor->bv_model);
+  btor_model_init_fun (btor, &btor->fun_model);
+
+  btor_iter_hashptr_init (&it, btor->bv_vars);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    var = btor_iter_hashptr_next (&it);
+    if (btor_node_is_proxy (var)) continue;
+    cvar = btor_node_get_by_id (clone, var->id);
+    assert (cvar);
+    bv = btor_model_get_bv (clone, cvar);
+    btor_model_add_to_bv (btor, btor->bv_model, var, bv);
+  }
+  btor_model_generate (btor, btor->bv_model, btor->fun_model, false);
+}
+
+/* Transfer the best assignment of the walker on 'clone' to 'btor'. */
+static void
+transfer_best_model (Btor *btor, Btor *clone)
+{
+  BtorNode *var, *cvar;
+  BtorHashTableData *d;
+  BtorPropSolver *slv, *cslv;
+  BtorPtrHashTableIterator it;
+
+  slv  = BTOR_PROP_SOLVER (btor);
+  cslv = BTOR_PROP_SOLVER (clone);
+  assert (cslv->best_model);
+
+  btor_model_init_bv (btor, &slv->best_model);
+  btor_iter_hashptr_init (&it, btor->bv_vars);
+  while (btor_iter_hashptr_has_next (&it))
+  {
+    var = btor_iter_hashptr_next (&it);
+    if (btor_node_is_proxy (var)) continue;
+    cvar = btor_node_get_by_id (clone, var->id);
+    assert (cvar);
+    if ((d = btor_hashint_map_get (cslv->best_model, cvar->id)))
+      btor_model_add_to_bv (btor, slv->best_model, var, d->as_ptr);
+  }
+  slv->best_nroots = cslv->best_nroots;
+}
+
+/* Run BTOR_OPT_PROP_THREADS walkers on clones of 'btor' concurrently, until
+ * one of them determines the result. */
+static BtorSolverResult
+sat_prop_solver_parallel (Btor *btor)
+{
+  assert (btor);
+
+  uint32_t i, num_threads;
+  double start;
+  BtorSolverResult result;
+  BtorPropSolver *slv, *cslv;
+  BtorPropContext ctx;
+  BtorPropWalker *walkers;
+  BtorMemMgr *mm;
+  pthread_t *threads;
+
+  start       = btor_util_time_stamp ();
+  mm          = btor->mm;
+  slv         = BTOR_PROP_SOLVER (btor);
+  num_threads = btor_opt_get (btor, BTOR_OPT_PROP_THREADS);
+
+  BTOR_CLR (&ctx);
+
+  /* clones are created upfront since cloning accesses 'btor' */
+  BTOR_CNEWN (mm, walkers, num_threads);
+  for (i = 0; i < num_threads; i++)
+  {
+    walkers[i].ctx   = &ctx;
+    walkers[i].clone = new_walker_clone (btor, &ctx, i);
+  }
+
+  pthread_mutex_init (&ctx.mutex, 0);
+  BTOR_NEWN (mm, threads, num_threads);
+  for (i = 0; i < num_threads; i++)
+    pthread_create (&threads[i], 0, run_walker, &walkers[i]);
+  for (i = 0; i < num_threads; i++) pthread_join (threads[i], 0);
+  BTOR_DELETEN (mm, threads, num_threads);
+  pthread_mutex_destroy (&ctx.mutex);
+
+  result = BTOR_RESULT_UNKNOWN;
+  if (ctx.winner)
+  {
+    result = ctx.winner->result;
+    if (result == BTOR_RESULT_SAT) transfer_model (btor, ctx.winner->clone);
+  }
+
+  for (i = 0; i < num_threads; i++)
+  {
+    cslv = BTOR_PROP_SOLVER (walkers[i].clone);
+    if (cslv)
+    {
+      slv->stats.restarts += cslv->stats.restarts;
+      slv->stats.moves += cslv->stats.moves;
+      slv->stats.rec_conf += cslv->stats.rec_conf;
+      slv->stats.non_rec_conf += cslv->stats.non_rec_conf;
+      slv->stats.props += cslv->stats.props;
+      slv->stats.props_cons += cslv->stats.props_cons;
+      slv->stats.props_inv += cslv->stats.props_inv;
+      slv->stats.updates += cslv->stats.updates;
+      slv->stats.inv_cache_hits += cslv->stats.inv_cache_hits;
+      slv->stats.inv_cache_misses += cslv->stats.inv_cache_misses;
+      slv->stats.inv_cache_flushes += cslv->stats.inv_cache_flushes;
+      if (cslv->best_model && cslv->best_nroots < slv->best_nroots)
+        transfer_best_model (btor, walkers[i].clone);
+    }
+    btor_delete (walkers[i].clone);
+  }
+
+  BTOR_MSG (btor->msg,
+            1,
+            "prop: %u walkers, %s by walker %d in %.2f seconds",
+            num_threads,
+            result == BTOR_RESULT_SAT
+                ? "sat"
+                : (result == BTOR_RESULT_UNSAT ? "unsat" : "unknown"),
+            ctx.winner ? (int32_t) (ctx.winner - walkers) : -1,
+            btor_util_time_stamp () - start);
+  BTOR_DELETEN (mm, walkers, num_threads);
+  return result;
+}
+#endif
+
 /* Note: failed assumptions handling not necessary, prop only works for SAT */
 static int32_t
 sat_prop_solver (BtorPropSolver *slv)
@@ -386,12 +753,28 @@ sat_prop_solver (BtorPropSolver *slv)
                       && btor->lambdas->count != 0),
               "prop engine supports QF_BV only");
 
-  /* Generate intial model, all bv vars are initialized with zero. We do
-   * not have to consider model_for_all_nodes, but let this be handled by
-   * the model generation (if enabled) after SAT has been determined. */
-  slv->api.generate_model ((BtorSolver *) slv, false, true);
+  /* Generate intial model, all bv vars are initialized with zero (or with
+   * their value in 'best_model' if given, see prop-warm-start). We do not
+   * have to consider model_for_all_nodes, but let this be handled by the
+   * model generation (if enabled) after SAT has been determined. */
+  if (slv->best_model)
+    btor_lsutils_init_model (btor, slv->best_model);
+  else
+    slv->api.generate_model ((BtorSolver *) slv, false, true);
+  slv->best_nroots = UINT32_MAX;
+#ifdef BTOR_HAVE_PTHREADS
+  if (btor_opt_get (btor, BTOR_OPT_PROP_THREADS) > 1)
+  {
+    sat_result = sat_prop_solver_parallel (btor);
+    goto DONE;
+  }
+#endif
   sat_result = sat_prop_solver_aux (btor);
 DONE:
+  /* keep best assignment (the model if satisfiable) as starting point of the
+   * next sat call */
+  if (!btor_opt_get (btor, BTOR_OPT_PROP_WARM_START) && slv->best_model)
+    btor_model_delete_bv (btor, &slv->best_model);
   return sat_result;
 }
 
@@ -422,10 +805,24 @@ print_stats_prop_solver (BtorPropSolver *slv)
   assert (slv->btor);
   assert (slv->btor->slv == (BtorSolver *) slv);
 
+  uint32_t i;
   Btor *btor = slv->btor;
 
   BTOR_MSG (btor->msg, 1, "");
   BTOR_MSG (btor->msg, 1, "restarts: %u", slv->stats.restarts);
+  if (btor_opt_get (btor, BTOR_OPT_PROP_ADAPTIVE))
+  {
+    for (i = 0; i < BTOR_PROP_NCONFIGS; i++)
+    {
+      if (!slv->adaptive.nselected[i]) continue;
+      BTOR_MSG (btor->msg,
+                1,
+                "   configuration %u: %u restarts, %.2f avg. reward",
+                i,
+                slv->adaptive.nselected[i],
+                slv->adaptive.reward[i] / slv->adaptive.nselected[i]);
+    }
+  }
   BTOR_MSG (btor->msg, 1, "moves: %u", slv->stats.moves);
   BTOR_MSG (btor->msg,
             1,
@@ -443,6 +840,12 @@ print_stats_prop_solver (BtorPropSolver *slv)
             "propagation (steps) per second: %.2f",
             (double) slv->stats.props / (btor->time.sat - btor->time.simplify));
   BTOR_MSG (btor->msg, 1, "updates (cone): %u", slv->stats.updates);
+  BTOR_MSG (btor->msg,
+            1,
+            "updates (cone) per move: %.2f",
+            slv->stats.moves
+                ? (double) slv->stats.updates / slv->stats.moves
+                : 0.0);
   BTOR_MSG (btor->msg, 1, "");
   BTOR_MSG (btor->msg,
             1,
@@ -452,6 +855,19 @@ print_stats_prop_solver (BtorPropSolver *slv)
             1,
             "propagation move conflicts (non-recoverable): %u",
             slv->stats.non_rec_conf);
+  BTOR_MSG (btor->msg, 1, "");
+  BTOR_MSG (btor->msg,
+            1,
+            "inverse value cache hits: %llu",
+            (unsigned long long) slv->stats.inv_cache_hits);
+  BTOR_MSG (btor->msg,
+            1,
+            "inverse value cache misses: %llu",
+            (unsigned long long) slv->stats.inv_cache_misses);
+  BTOR_MSG (btor->msg,
+            1,
+            "inverse value cache flushes: %u",
+            slv->stats.inv_cache_flushes);
 #ifndef NDEBUG
   BTOR_MSG (btor->msg, 1, "");
   BTOR_MSG (
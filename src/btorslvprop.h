@@ -13,6 +13,10 @@
 #include "btorslv.h"
 #include "btortypes.h"
 #include "utils/btorhashint.h"
+#include "utils/btorhashptr.h"
+
+/* number of option configurations for prop-adaptive */
+#define BTOR_PROP_NCONFIGS 16
 
 struct BtorPropSolver
 {
@@ -21,6 +25,14 @@ struct BtorPropSolver
   BtorIntHashTable *roots; /* map: maintains 'selected' */
   BtorIntHashTable *score;
 
+  /* cache for inverse value computations (see btorproputils.c) */
+  BtorPtrHashTable *inv_cache;
+
+  /* assignment of bv vars with the minimum number of unsatisfied roots,
+   * if set before a sat call, the search starts from this assignment */
+  BtorIntHashTable *best_model;
+  uint32_t best_nroots;
+
   /* current probability for selecting the cond when either the
    * 'then' or 'else' branch is const (path selection) */
   uint32_t flip_cond_const_prob;
@@ -31,6 +43,20 @@ struct BtorPropSolver
    * the 'then' or 'else' branch is const */
   uint32_t nflip_cond_const;
 
+  /* option configurations selected across restarts via bandit scheme
+   * (see prop-adaptive) */
+  struct
+  {
+    uint32_t cur; /* current configuration */
+    uint32_t nselected[BTOR_PROP_NCONFIGS];
+    double reward[BTOR_PROP_NCONFIGS];
+    /* user values of the options varied by the configurations */
+    uint32_t path_sel;
+    uint32_t prob_use_inv_value;
+    uint32_t prob_flip_cond;
+    uint32_t prob_slice_flip;
+  } adaptive;
+
   struct
   {
     uint32_t restarts;
@@ -41,6 +67,9 @@ struct BtorPropSolver
     uint64_t props_cons;
     uint64_t props_inv;
     uint64_t updates;
+    uint64_t inv_cache_hits;
+    uint64_t inv_cache_misses;
+    uint32_t inv_cache_flushes;
 
 #ifndef NDEBUG
     uint32_t inv_add;
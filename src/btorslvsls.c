@@ -422,6 +422,114 @@ cmp_sls_moves_qsort (const void *move1, const void *move2)
     }                                                                          \
   } while (0)
 
+/* Score candidate moves in batches rather than one at a time?  Not possible
+ * with 'sls-move-inc-move-test', where each candidate depends on the best
+ * candidate tried so far. */
+static inline bool
+use_batch_moves (Btor *btor)
+{
+  assert (btor);
+  return btor_opt_get (btor, BTOR_OPT_SLS_BATCH_SIZE) > 1
+         && !btor_opt_get (btor, BTOR_OPT_SLS_MOVE_INC_MOVE_TEST);
+}
+
+/* Score given candidate moves of kind 'mk' (maps from input id to new
+ * assignment) in batches of at most 'sls-batch-size' moves per traversal of
+ * the cone of influence.  Takes ownership of the candidate maps. */
+static bool
+select_moves_batch (Btor *btor,
+                    BtorVoidPtrStack *moves,
+                    BtorSLSMoveKind mk,
+                    int32_t gw)
+{
+  assert (btor);
+  assert (moves);
+
+  uint32_t i, j, k, n, nmoves, nroots, bsize, sls_strat;
+  int32_t *roots;
+  bool done;
+  double start, sc, *weights, *res;
+  BtorSLSMove *m;
+  BtorIntHashTable *cans;
+  BtorIntHashTableIterator iit;
+  BtorSLSSolver *slv;
+
+  start     = btor_util_time_stamp ();
+  done      = false;
+  slv       = BTOR_SLS_SOLVER (btor);
+  sls_strat = btor_opt_get (btor, BTOR_OPT_SLS_STRATEGY);
+  nmoves    = BTOR_COUNT_STACK (*moves);
+  nroots    = slv->weights->count;
+  bsize     = BTOR_MIN_UTIL (btor_opt_get (btor, BTOR_OPT_SLS_BATCH_SIZE),
+                         nmoves);
+
+  BTOR_NEWN (btor->mm, roots, nroots);
+  BTOR_NEWN (btor->mm, weights, nroots);
+  BTOR_NEWN (btor->mm, res, (size_t) nroots * bsize);
+
+  btor_iter_hashint_init (&iit, slv->weights);
+  for (j = 0; btor_iter_hashint_has_next (&iit); j++)
+  {
+    weights[j] =
+        (double) ((BtorSLSConstrData *) slv->weights->data[iit.cur_pos].as_ptr)
+            ->weight;
+    roots[j] = btor_iter_hashint_next (&iit);
+  }
+
+  for (i = 0; i < nmoves; i += n)
+  {
+    n = BTOR_MIN_UTIL (bsize, nmoves - i);
+    if (slv->nflips)
+    {
+      if (slv->stats.flips >= slv->nflips)
+      {
+        slv->terminate = true;
+        goto DONE;
+      }
+      n = BTOR_MIN_UTIL (n, slv->nflips - slv->stats.flips);
+    }
+
+    btor_lsutils_compute_scores_batch (btor,
+                                       btor->bv_model,
+                                       slv->score,
+                                       (BtorIntHashTable **) moves->start + i,
+                                       n,
+                                       roots,
+                                       nroots,
+                                       res,
+                                       &slv->stats.updates);
+
+    for (k = 0; k < n; k++)
+    {
+      cans = BTOR_PEEK_STACK (*moves, i + k);
+      BTOR_POKE_STACK (*moves, i + k, 0);
+      slv->stats.flips += 1;
+      sc   = 0.0;
+      done = true;
+      for (j = 0; j < nroots; j++)
+      {
+        assert (res[k * nroots + j] >= 0.0 && res[k * nroots + j] <= 1.0);
+        if (res[k * nroots + j] < 1.0) done = false;
+        sc += weights[j] * res[k * nroots + j];
+      }
+      BTOR_SLS_SELECT_MOVE_CHECK_SCORE (sc);
+    }
+  }
+
+DONE:
+  for (i = 0; i < nmoves; i++)
+  {
+    cans = BTOR_PEEK_STACK (*moves, i);
+    if (cans) BTOR_SLS_DELETE_CANS (cans);
+  }
+  BTOR_RELEASE_STACK (*moves);
+  BTOR_DELETEN (btor->mm, roots, nroots);
+  BTOR_DELETEN (btor->mm, weights, nroots);
+  BTOR_DELETEN (btor->mm, res, (size_t) nroots * bsize);
+  slv->time.update_cone += btor_util_time_stamp () - start;
+  return done;
+}
+
 static inline bool
 select_inc_dec_not_move (Btor *btor,
                          BtorBitVector *(*fun) (BtorMemMgr *,
@@ -431,13 +539,14 @@ select_inc_dec_not_move (Btor *btor,
 {
   size_t i;
   uint32_t sls_strat;
-  bool done;
+  bool done, batch;
   double sc;
   BtorSLSMove *m;
   BtorSLSMoveKind mk;
   BtorBitVector *ass, *max_neigh;
   BtorNode *can;
   BtorIntHashTable *cans, *bv_model, *score;
+  BtorVoidPtrStack moves;
   BtorIntHashTableIterator iit;
   BtorSLSSolver *slv;
 
@@ -455,9 +564,19 @@ select_inc_dec_not_move (Btor *btor,
     mk = BTOR_SLS_MOVE_NOT;
   }
 
-  bv_model = btor_model_clone_bv (btor, btor->bv_model, true);
-  score =
-      btor_hashint_map_clone (btor->mm, slv->score, btor_clone_data_as_dbl, 0);
+  batch    = use_batch_moves (btor);
+  bv_model = 0;
+  score    = 0;
+  if (batch)
+  {
+    BTOR_INIT_STACK (btor->mm, moves);
+  }
+  else
+  {
+    bv_model = btor_model_clone_bv (btor, btor->bv_model, true);
+    score    = btor_hashint_map_clone (
+        btor->mm, slv->score, btor_clone_data_as_dbl, 0);
+  }
 
   cans = btor_hashint_map_new (btor->mm);
 
@@ -480,6 +599,12 @@ select_inc_dec_not_move (Btor *btor,
             : fun (btor->mm, ass);
   }
 
+  if (batch)
+  {
+    BTOR_PUSH_STACK (moves, cans);
+    return select_moves_batch (btor, &moves, mk, gw);
+  }
+
   sc = try_move (btor, bv_model, score, cans, &done);
   if (slv->terminate)
   {
@@ -489,8 +614,8 @@ select_inc_dec_not_move (Btor *btor,
   BTOR_SLS_SELECT_MOVE_CHECK_SCORE (sc);
 
 DONE:
-  btor_model_delete_bv (btor, &bv_model);
-  btor_hashint_map_delete (score);
+  if (bv_model) btor_model_delete_bv (btor, &bv_model);
+  if (score) btor_hashint_map_delete (score);
   return done;
 }
 
@@ -499,13 +624,14 @@ select_flip_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
 {
   size_t i, n_endpos;
   uint32_t pos, cpos, sls_strat;
-  bool done = false;
+  bool done = false, batch;
   double sc;
   BtorSLSMove *m;
   BtorSLSMoveKind mk;
   BtorBitVector *ass, *max_neigh;
   BtorNode *can;
   BtorIntHashTable *cans, *bv_model, *score;
+  BtorVoidPtrStack moves;
   BtorIntHashTableIterator iit;
   BtorSLSSolver *slv;
 
@@ -514,9 +640,19 @@ select_flip_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
 
   mk = BTOR_SLS_MOVE_FLIP;
 
-  bv_model = btor_model_clone_bv (btor, btor->bv_model, true);
-  score =
-      btor_hashint_map_clone (btor->mm, slv->score, btor_clone_data_as_dbl, 0);
+  batch    = use_batch_moves (btor);
+  bv_model = 0;
+  score    = 0;
+  if (batch)
+  {
+    BTOR_INIT_STACK (btor->mm, moves);
+  }
+  else
+  {
+    bv_model = btor_model_clone_bv (btor, btor->bv_model, true);
+    score    = btor_hashint_map_clone (
+        btor->mm, slv->score, btor_clone_data_as_dbl, 0);
+  }
 
   for (pos = 0, n_endpos = 0; n_endpos < BTOR_COUNT_STACK (*candidates); pos++)
   {
@@ -544,6 +680,11 @@ select_flip_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
               : btor_bv_flipped_bit (btor->mm, ass, cpos);
     }
 
+    if (batch)
+    {
+      BTOR_PUSH_STACK (moves, cans);
+      continue;
+    }
     sc = try_move (btor, bv_model, score, cans, &done);
     if (slv->terminate)
     {
@@ -553,9 +694,11 @@ select_flip_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
     BTOR_SLS_SELECT_MOVE_CHECK_SCORE (sc);
   }
 
+  if (batch) done = select_moves_batch (btor, &moves, mk, gw);
+
 DONE:
-  btor_model_delete_bv (btor, &bv_model);
-  btor_hashint_map_delete (score);
+  if (bv_model) btor_model_delete_bv (btor, &bv_model);
+  if (score) btor_hashint_map_delete (score);
   return done;
 }
 
@@ -564,13 +707,14 @@ select_flip_range_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
 {
   size_t i, n_endpos;
   uint32_t up, cup, clo, sls_strat, bw;
-  bool done = false;
+  bool done = false, batch;
   double sc;
   BtorSLSMove *m;
   BtorSLSMoveKind mk;
   BtorBitVector *ass, *max_neigh;
   BtorNode *can;
   BtorIntHashTable *cans, *bv_model, *score;
+  BtorVoidPtrStack moves;
   BtorIntHashTableIterator iit;
   BtorSLSSolver *slv;
 
@@ -579,9 +723,19 @@ select_flip_range_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
 
   mk = BTOR_SLS_MOVE_FLIP_RANGE;
 
-  bv_model = btor_model_clone_bv (btor, btor->bv_model, true);
-  score =
-      btor_hashint_map_clone (btor->mm, slv->score, btor_clone_data_as_dbl, 0);
+  batch    = use_batch_moves (btor);
+  bv_model = 0;
+  score    = 0;
+  if (batch)
+  {
+    BTOR_INIT_STACK (btor->mm, moves);
+  }
+  else
+  {
+    bv_model = btor_model_clone_bv (btor, btor->bv_model, true);
+    score    = btor_hashint_map_clone (
+        btor->mm, slv->score, btor_clone_data_as_dbl, 0);
+  }
 
   for (up = 1, n_endpos = 0; n_endpos < BTOR_COUNT_STACK (*candidates);
        up = 2 * up + 1)
@@ -624,6 +778,11 @@ select_flip_range_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
               : btor_bv_flipped_bit_range (btor->mm, ass, cup, clo);
     }
 
+    if (batch)
+    {
+      BTOR_PUSH_STACK (moves, cans);
+      continue;
+    }
     sc = try_move (btor, bv_model, score, cans, &done);
     if (slv->terminate)
     {
@@ -633,9 +792,11 @@ select_flip_range_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
     BTOR_SLS_SELECT_MOVE_CHECK_SCORE (sc);
   }
 
+  if (batch) done = select_moves_batch (btor, &moves, mk, gw);
+
 DONE:
-  btor_model_delete_bv (btor, &bv_model);
-  btor_hashint_map_delete (score);
+  if (bv_model) btor_model_delete_bv (btor, &bv_model);
+  if (score) btor_hashint_map_delete (score);
   return done;
 }
 
@@ -645,13 +806,14 @@ select_flip_segment_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
   size_t i, n_endpos;
   int32_t ctmp;
   uint32_t lo, clo, up, cup, seg, sls_strat, bw;
-  bool done = false;
+  bool done = false, batch;
   double sc;
   BtorSLSMove *m;
   BtorSLSMoveKind mk;
   BtorBitVector *ass, *max_neigh;
   BtorNode *can;
   BtorIntHashTable *cans, *bv_model, *score;
+  BtorVoidPtrStack moves;
   BtorIntHashTableIterator iit;
   BtorSLSSolver *slv;
 
@@ -660,9 +822,19 @@ select_flip_segment_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
 
   mk = BTOR_SLS_MOVE_FLIP_SEGMENT;
 
-  bv_model = btor_model_clone_bv (btor, btor->bv_model, true);
-  score =
-      btor_hashint_map_clone (btor->mm, slv->score, btor_clone_data_as_dbl, 0);
+  batch    = use_batch_moves (btor);
+  bv_model = 0;
+  score    = 0;
+  if (batch)
+  {
+    BTOR_INIT_STACK (btor->mm, moves);
+  }
+  else
+  {
+    bv_model = btor_model_clone_bv (btor, btor->bv_model, true);
+    score    = btor_hashint_map_clone (
+        btor->mm, slv->score, btor_clone_data_as_dbl, 0);
+  }
 
   for (seg = 2; seg <= 8; seg <<= 1)
   {
@@ -711,6 +883,11 @@ select_flip_segment_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
                 : btor_bv_flipped_bit_range (btor->mm, ass, cup, clo);
       }
 
+      if (batch)
+      {
+        BTOR_PUSH_STACK (moves, cans);
+        continue;
+      }
       sc = try_move (btor, bv_model, score, cans, &done);
       if (slv->terminate)
       {
@@ -721,9 +898,11 @@ select_flip_segment_move (Btor *btor, BtorNodePtrStack *candidates, int32_t gw)
     }
   }
 
+  if (batch) done = select_moves_batch (btor, &moves, mk, gw);
+
 DONE:
-  btor_model_delete_bv (btor, &bv_model);
-  btor_hashint_map_delete (score);
+  if (bv_model) btor_model_delete_bv (btor, &bv_model);
+  if (score) btor_hashint_map_delete (score);
   return done;
 }
 
@@ -1389,6 +1568,8 @@ clone_sls_solver (Btor *clone, BtorSLSSolver *slv, BtorNodeMap *exp_map)
 
   res->max_cans = btor_hashint_map_clone (
       clone->mm, slv->max_cans, btor_clone_data_as_bv_ptr, 0);
+  /* best assignment is not cloned */
+  res->best_model = 0;
 
   return res;
 }
@@ -1439,6 +1620,7 @@ delete_sls_solver (BtorSLSSolver *slv)
     }
     btor_hashint_map_delete (slv->max_cans);
   }
+  if (slv->best_model) btor_model_delete_bv (btor, &slv->best_model);
   BTOR_DELETE (btor->mm, slv);
 }
 
@@ -1478,16 +1660,23 @@ sat_sls_solver (BtorSLSSolver *slv)
                       && btor->lambdas->count != 0),
               "sls engine supports QF_BV only");
 
-  /* Generate intial model, all bv vars are initialized with zero. We do
-   * not have to consider model_for_all_nodes, but let this be handled by
-   * the model generation (if enabled) after SAT has been determined. */
-  slv->api.generate_model ((BtorSolver *) slv, false, true);
+  /* Generate intial model, all bv vars are initialized with zero (or with
+   * their value in 'best_model' if given, see sls-warm-start). We do not
+   * have to consider model_for_all_nodes, but let this be handled by the
+   * model generation (if enabled) after SAT has been determined. */
+  if (slv->best_model)
+    btor_lsutils_init_model (btor, slv->best_model);
+  else
+    slv->api.generate_model ((BtorSolver *) slv, false, true);
+  slv->best_nroots = UINT32_MAX;
 
   /* init assertion weights of ALL roots */
   assert (!slv->weights);
   slv->weights = btor_hashint_map_new (btor->mm);
-  assert (btor->synthesized_constraints->count == 0);
+  /* constraints are synthesized if sls runs between SAT calls of the core
+   * engine (see fun-ls-bursts) */
   btor_iter_hashptr_init (&pit, btor->unsynthesized_constraints);
+  btor_iter_hashptr_queue (&pit, btor->synthesized_constraints);
   while (btor_iter_hashptr_has_next (&pit))
   {
     root = btor_iter_hashptr_next (&pit);
@@ -1508,6 +1697,9 @@ sat_sls_solver (BtorSLSSolver *slv)
     if (btor_hashptr_table_get (btor->unsynthesized_constraints,
                                 btor_node_invert (root)))
       goto UNSAT;
+    if (btor_hashptr_table_get (btor->synthesized_constraints,
+                                btor_node_invert (root)))
+      goto UNSAT;
     if (btor_hashptr_table_get (btor->assumptions, btor_node_invert (root)))
       goto UNSAT;
     id = btor_node_get_id (root);
@@ -1540,8 +1732,8 @@ sat_sls_solver (BtorSLSSolver *slv)
     /* collect unsatisfied roots (kept up-to-date in update_cone) */
     assert (!slv->roots);
     slv->roots = btor_hashint_map_new (btor->mm);
-    assert (btor->synthesized_constraints->count == 0);
     btor_iter_hashptr_init (&pit, btor->unsynthesized_constraints);
+    btor_iter_hashptr_queue (&pit, btor->synthesized_constraints);
     btor_iter_hashptr_queue (&pit, btor->assumptions);
     while (btor_iter_hashptr_has_next (&pit))
     {
@@ -1559,6 +1751,9 @@ sat_sls_solver (BtorSLSSolver *slv)
     btor_slsutils_compute_sls_scores (
         btor, btor->bv_model, btor->fun_model, slv->score);
 
+    btor_lsutils_update_best_model (
+        btor, slv->roots, &slv->best_model, &slv->best_nroots);
+
     if (!slv->roots->count) goto SAT;
 
     for (j = 0, max_steps = BTOR_SLS_MAXSTEPS (slv->stats.restarts + 1);
@@ -1575,6 +1770,8 @@ sat_sls_solver (BtorSLSSolver *slv)
 
       if (!move (btor, nmoves)) goto UNSAT;
       nmoves += 1;
+      btor_lsutils_update_best_model (
+          btor, slv->roots, &slv->best_model, &slv->best_nroots);
 
       if (!slv->roots->count) goto SAT;
     }
@@ -1616,6 +1813,10 @@ DONE:
     btor_hashint_map_delete (slv->score);
     slv->score = 0;
   }
+  /* keep best assignment (the model if satisfiable) as starting point of the
+   * next sat call */
+  if (!btor_opt_get (btor, BTOR_OPT_SLS_WARM_START) && slv->best_model)
+    btor_model_delete_bv (btor, &slv->best_model);
   return sat_result;
 }
 
@@ -1657,6 +1858,16 @@ print_stats_sls_solver (BtorSLSSolver *slv)
   BTOR_MSG (btor->msg, 1, "sls moves: %d", slv->stats.moves);
   BTOR_MSG (btor->msg, 1, "sls flips: %d", slv->stats.flips);
   BTOR_MSG (btor->msg, 1, "sls propagation steps: %u", slv->stats.props);
+  BTOR_MSG (btor->msg,
+            1,
+            "sls updates (cone): %llu",
+            (unsigned long long) slv->stats.updates);
+  BTOR_MSG (btor->msg,
+            1,
+            "sls updates (cone) per move: %.2f",
+            slv->stats.moves
+                ? (double) slv->stats.updates / slv->stats.moves
+                : 0.0);
   BTOR_MSG (btor->msg, 1, "");
   BTOR_MSG (btor->msg,
             1,
@@ -62,6 +62,11 @@ struct BtorSLSSolver
   BtorIntHashTable *weights; /* also maintains assertion weights */
   BtorIntHashTable *score;   /* sls score */
 
+  /* assignment of bv vars with the minimum number of unsatisfied roots,
+   * if set before a sat call, the search starts from this assignment */
+  BtorIntHashTable *best_model;
+  uint32_t best_nroots;
+
   uint32_t nflips; /* limit, disabled if 0 */
   bool terminate;
 
@@ -327,6 +327,9 @@ enum BtorOption
 
       Enable (``value``: 1) or disable (``value``: 0) prop engine as
       preprocessing step within sequential portfolio setting.
+      Formulas with UFs or arrays (but without function equalities) are
+      Ackermannized into a bit-vector abstraction for the prop engine, whose
+      best assignment seeds the phases of the SAT solver.
    */
   BTOR_OPT_FUN_PREPROP,
 
@@ -335,6 +338,9 @@ enum BtorOption
 
       Enable (``value``: 1) or disable (``value``: 0) sls engine as
       preprocessing step within sequential portfolio setting.
+      Formulas with UFs or arrays (but without function equalities) are
+      Ackermannized into a bit-vector abstraction for the sls engine, whose
+      best assignment seeds the phases of the SAT solver.
    */
   BTOR_OPT_FUN_PRESLS,
 
@@ -855,6 +861,23 @@ enum BtorOption
   BTOR_OPT_QUANT_FIXSYNTH,
   BTOR_OPT_RW_ZERO_LOWER_SLICE,
   BTOR_OPT_NONDESTR_SUBST,
+  BTOR_OPT_PRINT_DIMACS_STREAM,
+  BTOR_OPT_SAT_CALL_STATS,
+  BTOR_OPT_CUBE_THREADS,
+  BTOR_OPT_CUBE_DEPTH,
+  BTOR_OPT_FUN_PHASES,
+  BTOR_OPT_FUN_INC_PROP,
+  BTOR_OPT_FUN_WEQ_LEMMAS,
+  BTOR_OPT_FUN_LEMMA_GC,
+  BTOR_OPT_FUN_THREADS,
+  BTOR_OPT_PROP_THREADS,
+  BTOR_OPT_PROP_INV_CACHE,
+  BTOR_OPT_SLS_BATCH_SIZE,
+  BTOR_OPT_FUN_LS_BURSTS,
+  BTOR_OPT_PROP_WARM_START,
+  BTOR_OPT_SLS_WARM_START,
+  BTOR_OPT_AIGPROP_LANES,
+  BTOR_OPT_PROP_ADAPTIVE,
   /* this MUST be the last entry! */
   BTOR_OPT_NUM_OPTS,
 };
@@ -986,6 +1009,14 @@ enum BtorOptBetaReduceMode
 };
 typedef enum BtorOptBetaReduceMode BtorOptBetaReduceMode;
 
+enum BtorOptDimacsStream
+{
+  BTOR_DIMACS_STREAM_NONE,
+  BTOR_DIMACS_STREAM_PLAIN,
+  BTOR_DIMACS_STREAM_GZIP,
+};
+typedef enum BtorOptDimacsStream BtorOptDimacsStream;
+
 /* --------------------------------------------------------------------- */
 
 /* Callback function to be executed on abort, primarily intended to be used for
@@ -743,6 +743,11 @@ NEXT:
       PARSE_ARGS1 (tok, str);
       boolector_assume (btor, hmap_get (hmap, arg1_str));
     }
+    else if (!strcmp (tok, "freeze_out"))
+    {
+      PARSE_ARGS1 (tok, str);
+      boolector_freeze_out (btor, hmap_get (hmap, arg1_str));
+    }
     else if (!strcmp (tok, "reset_assumptions"))
     {
       PARSE_ARGS0 (tok);
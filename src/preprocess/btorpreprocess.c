@@ -49,6 +49,30 @@ btor_simplify (Btor *btor)
 
   if (btor->inconsistent) goto DONE;
 
+  btor->stats.simplify.calls++;
+  btor->stats.simplify.constraints += btor->simp_delta.constraints;
+  btor->stats.simplify.assumptions += btor->simp_delta.assumptions;
+
+  /* Only the passes below process the formula as a whole, variable
+   * substitution and embedded constraint processing only consider new
+   * constraints. Skip all passes if no constraints and assumptions were added
+   * since the last call. */
+  if (btor->simp_delta.simplified && btor->simp_delta.constraints == 0
+      && btor->simp_delta.assumptions == 0
+      && btor->varsubst_constraints->count == 0
+      && btor->embedded_constraints->count == 0)
+  {
+    btor->stats.simplify.skipped++;
+    BTOR_MSG (btor->msg, 1, "formula unchanged, skipping simplification");
+    goto DONE;
+  }
+
+  BTOR_MSG (btor->msg,
+            1,
+            "simplifying %u new constraints, %u new assumptions",
+            btor->simp_delta.constraints,
+            btor->simp_delta.assumptions);
+
   /* empty varsubst_constraints table if variable substitution was disabled
    * after adding variable substitution constraints (they are still in
    * unsynthesized_constraints).
@@ -123,7 +147,11 @@ btor_simplify (Btor *btor)
         && btor_opt_get (btor, BTOR_OPT_SKELETON_PREPROC))
     {
       skelrounds++;
-      if (skelrounds <= 1)  // TODO only one?
+      /* skeleton preprocessing only considers constraints */
+      if (skelrounds <= 1 && btor->simp_delta.simplified
+          && btor->simp_delta.constraints == 0)
+        btor->stats.simplify.skel_skipped++;
+      else if (skelrounds <= 1)  // TODO only one?
       {
         btor_process_skeleton (btor);
         if (btor->inconsistent)
@@ -144,7 +172,6 @@ btor_simplify (Btor *btor)
 
     if (btor_opt_get (btor, BTOR_OPT_UCOPT)
         && btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2
-        && !btor_opt_get (btor, BTOR_OPT_INCREMENTAL)
         && !btor_opt_get (btor, BTOR_OPT_MODEL_GEN))
     {
       btor_optimize_unconstrained (btor);
@@ -197,6 +224,10 @@ btor_simplify (Btor *btor)
            || btor->embedded_constraints->count);
 
 DONE:
+  btor->simp_delta.simplified  = true;
+  btor->simp_delta.constraints = 0;
+  btor->simp_delta.assumptions = 0;
+
   delta = btor_util_time_stamp () - start;
   btor->time.simplify += delta;
   BTOR_MSG (btor->msg, 1, "%u rewriting rounds in %.1f seconds", rounds, delta);
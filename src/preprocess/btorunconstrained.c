@@ -82,12 +82,11 @@ btor_optimize_unconstrained (Btor *btor)
 {
   assert (btor);
   assert (btor_opt_get (btor, BTOR_OPT_REWRITE_LEVEL) > 2);
-  assert (!btor_opt_get (btor, BTOR_OPT_INCREMENTAL));
   assert (!btor_opt_get (btor, BTOR_OPT_MODEL_GEN));
 
   double start, delta;
   uint32_t i, num_ucs;
-  bool uc[3], ucp[3];
+  bool uc[3], ucp[3], inc;
   BtorNode *cur, *cur_parent;
   BtorNodePtrStack stack, roots;
   BtorPtrHashTableIterator it;
@@ -100,6 +99,12 @@ btor_optimize_unconstrained (Btor *btor)
 
   if (btor->bv_vars->count == 0 && btor->ufs->count == 0) return;
 
+  /* In incremental mode, inputs may occur in future assertions and
+   * assumptions, hence only inputs declared via btor_freeze_out_exp are
+   * unconstrained candidates. */
+  inc = btor_opt_get (btor, BTOR_OPT_INCREMENTAL) != 0;
+  if (inc && btor->frozen_out->count == 0) return;
+
   BTORLOG (1, "start unconstrained optimization");
 
   start = btor_util_time_stamp ();
@@ -123,6 +128,8 @@ btor_optimize_unconstrained (Btor *btor)
     assert (btor_node_is_regular (cur));
 
     if (btor_node_is_simplified (cur)) continue;
+    if (inc && !btor_hashint_table_contains (btor->frozen_out, cur->id))
+      continue;
 
     if (cur->parents == 1)
     {
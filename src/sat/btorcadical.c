@@ -35,6 +35,14 @@ add (BtorSATMgr *smgr, int32_t lit)
   ccadical_add (smgr->solver, lit);
 }
 
+static void
+add_clauses (BtorSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  CCaDiCaL *slv = smgr->solver;
+  size_t i;
+  for (i = 0; i < n; i++) ccadical_add (slv, lits[i]);
+}
+
 static void
 assume (BtorSATMgr *smgr, int32_t lit)
 {
@@ -110,6 +118,12 @@ melt (BtorSATMgr *smgr, int32_t lit)
   if (smgr->inc_required) ccadical_melt (smgr->solver, lit);
 }
 
+static void
+phase (BtorSATMgr *smgr, int32_t lit)
+{
+  ccadical_phase (smgr->solver, lit);
+}
+
 /*------------------------------------------------------------------------*/
 
 bool
@@ -124,6 +138,7 @@ btor_sat_enable_cadical (BtorSATMgr *smgr)
 
   BTOR_CLR (&smgr->api);
   smgr->api.add              = add;
+  smgr->api.add_clauses      = add_clauses;
   smgr->api.assume           = assume;
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = enable_verbosity;
@@ -132,6 +147,7 @@ btor_sat_enable_cadical (BtorSATMgr *smgr)
   smgr->api.inc_max_var      = 0;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
@@ -171,6 +171,13 @@ add (BtorSATMgr* smgr, int32_t lit)
   solver->add (lit);
 }
 
+static void
+add_clauses (BtorSATMgr* smgr, const int32_t* lits, size_t n)
+{
+  BtorCMS* solver = (BtorCMS*) smgr->solver;
+  for (size_t i = 0; i < n; i++) solver->add (lits[i]);
+}
+
 static int32_t
 sat (BtorSATMgr* smgr, int32_t limit)
 {
@@ -258,6 +265,7 @@ btor_sat_enable_cms (BtorSATMgr* smgr)
 
   BTOR_CLR (&smgr->api);
   smgr->api.add              = add;
+  smgr->api.add_clauses      = add_clauses;
   smgr->api.assume           = assume;
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = enable_verbosity;
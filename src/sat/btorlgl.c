@@ -60,6 +60,15 @@ add (BtorSATMgr *smgr, int32_t lit)
   lgladd (blgl->lgl, lit);
 }
 
+static void
+add_clauses (BtorSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  BtorLGL *blgl = smgr->solver;
+  LGL *lgl      = blgl->lgl;
+  size_t i;
+  for (i = 0; i < n; i++) lgladd (lgl, lits[i]);
+}
+
 static int32_t
 sat (BtorSATMgr *smgr, int32_t limit)
 {
@@ -230,6 +239,20 @@ stats (BtorSATMgr *smgr)
   BTOR_MSG (smgr->btor->msg, 1, "%d forked", blgl->nforked);
 }
 
+static int64_t
+conflicts (BtorSATMgr *smgr)
+{
+  BtorLGL *blgl = smgr->solver;
+  return lglgetconfs (blgl->lgl);
+}
+
+static int64_t
+decisions (BtorSATMgr *smgr)
+{
+  BtorLGL *blgl = smgr->solver;
+  return lglgetdecs (blgl->lgl);
+}
+
 /*------------------------------------------------------------------------*/
 
 static void
@@ -246,6 +269,13 @@ melt (BtorSATMgr *smgr, int32_t lit)
   if (smgr->inc_required) lglmelt (blgl->lgl, lit);
 }
 
+static void
+phase (BtorSATMgr *smgr, int32_t lit)
+{
+  BtorLGL *blgl = smgr->solver;
+  lglsetphase (blgl->lgl, lit);
+}
+
 static int32_t
 failed (BtorSATMgr *smgr, int32_t lit)
 {
@@ -310,6 +340,7 @@ btor_sat_enable_lingeling (BtorSATMgr *smgr)
 
   BTOR_CLR (&smgr->api);
   smgr->api.add              = add;
+  smgr->api.add_clauses      = add_clauses;
   smgr->api.assume           = assume;
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = enable_verbosity;
@@ -318,6 +349,7 @@ btor_sat_enable_lingeling (BtorSATMgr *smgr)
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
   smgr->api.melt             = melt;
+  smgr->api.phase            = phase;
   smgr->api.repr             = repr;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
@@ -326,6 +358,8 @@ btor_sat_enable_lingeling (BtorSATMgr *smgr)
   smgr->api.stats            = stats;
   smgr->api.clone            = clone;
   smgr->api.setterm          = setterm;
+  smgr->api.conflicts        = conflicts;
+  smgr->api.decisions        = decisions;
   return true;
 }
 
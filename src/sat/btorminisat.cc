@@ -123,6 +123,12 @@ class BtorMiniSAT : public SimpSolver
     return res;
   }
 
+  void phase (int32_t lit)
+  {
+    Lit l = import (lit);
+    setPolarity (var (l), lbool (sign (l)));
+  }
+
   int32_t deref (int32_t lit)
   {
     if (nomodel) return fixed (lit);
@@ -148,6 +154,13 @@ add (BtorSATMgr* smgr, int32_t lit)
   solver->add (lit);
 }
 
+static void
+add_clauses (BtorSATMgr* smgr, const int32_t* lits, size_t n)
+{
+  BtorMiniSAT* solver = (BtorMiniSAT*) smgr->solver;
+  for (size_t i = 0; i < n; i++) solver->add (lits[i]);
+}
+
 static int32_t
 sat (BtorSATMgr* smgr, int32_t limit)
 {
@@ -226,6 +239,27 @@ stats (BtorSATMgr* smgr)
   fflush (stdout);
 }
 
+static int64_t
+conflicts (BtorSATMgr* smgr)
+{
+  BtorMiniSAT* solver = (BtorMiniSAT*) smgr->solver;
+  return solver->conflicts;
+}
+
+static int64_t
+decisions (BtorSATMgr* smgr)
+{
+  BtorMiniSAT* solver = (BtorMiniSAT*) smgr->solver;
+  return solver->decisions;
+}
+
+static void
+phase (BtorSATMgr* smgr, int32_t lit)
+{
+  BtorMiniSAT* solver = (BtorMiniSAT*) smgr->solver;
+  solver->phase (lit);
+}
+
 /*------------------------------------------------------------------------*/
 
 bool
@@ -240,6 +274,7 @@ btor_sat_enable_minisat (BtorSATMgr* smgr)
 
   BTOR_CLR (&smgr->api);
   smgr->api.add              = add;
+  smgr->api.add_clauses      = add_clauses;
   smgr->api.assume           = assume;
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = enable_verbosity;
@@ -247,12 +282,15 @@ btor_sat_enable_minisat (BtorSATMgr* smgr)
   smgr->api.fixed            = fixed;
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
   smgr->api.set_output       = 0;
   smgr->api.set_prefix       = 0;
   smgr->api.stats            = stats;
+  smgr->api.conflicts        = conflicts;
+  smgr->api.decisions        = decisions;
   return true;
 }
 };
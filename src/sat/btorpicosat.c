@@ -39,6 +39,14 @@ add (BtorSATMgr *smgr, int32_t lit)
   (void) picosat_add (smgr->solver, lit);
 }
 
+static void
+add_clauses (BtorSATMgr *smgr, const int32_t *lits, size_t n)
+{
+  PicoSAT *ps = smgr->solver;
+  size_t i;
+  for (i = 0; i < n; i++) (void) picosat_add (ps, lits[i]);
+}
+
 static int32_t
 sat (BtorSATMgr *smgr, int32_t limit)
 {
@@ -88,6 +96,12 @@ stats (BtorSATMgr *smgr)
   picosat_stats (smgr->solver);
 }
 
+static int64_t
+decisions (BtorSATMgr *smgr)
+{
+  return picosat_decisions (smgr->solver);
+}
+
 static int32_t
 fixed (BtorSATMgr *smgr, int32_t lit)
 {
@@ -108,6 +122,12 @@ failed (BtorSATMgr *smgr, int32_t lit)
   return picosat_failed_assumption (smgr->solver, lit);
 }
 
+static void
+phase (BtorSATMgr *smgr, int32_t lit)
+{
+  picosat_set_default_phase_lit (smgr->solver, lit, 1);
+}
+
 /*------------------------------------------------------------------------*/
 
 bool
@@ -122,6 +142,7 @@ btor_sat_enable_picosat (BtorSATMgr *smgr)
 
   BTOR_CLR (&smgr->api);
   smgr->api.add              = add;
+  smgr->api.add_clauses      = add_clauses;
   smgr->api.assume           = assume;
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = enable_verbosity;
@@ -130,12 +151,14 @@ btor_sat_enable_picosat (BtorSATMgr *smgr)
   smgr->api.inc_max_var      = inc_max_var;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
   smgr->api.set_output       = set_output;
   smgr->api.set_prefix       = set_prefix;
   smgr->api.stats            = stats;
+  smgr->api.decisions        = decisions;
   return true;
 }
 /*------------------------------------------------------------------------*/
@@ -0,0 +1,50 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2007-2021 by the authors listed in the AUTHORS file.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "utils/btorintheap.h"
+
+void
+btor_intheap_push (BtorIntStack *heap, int32_t x)
+{
+  assert (heap);
+
+  uint32_t i, p;
+
+  BTOR_PUSH_STACK (*heap, x);
+  for (i = BTOR_COUNT_STACK (*heap) - 1; i > 0; i = p)
+  {
+    p = (i - 1) / 2;
+    if (heap->start[p] <= x) break;
+    heap->start[i] = heap->start[p];
+  }
+  heap->start[i] = x;
+}
+
+int32_t
+btor_intheap_pop (BtorIntStack *heap)
+{
+  assert (heap);
+  assert (!BTOR_EMPTY_STACK (*heap));
+
+  int32_t res, x;
+  uint32_t i, c, n;
+
+  res = heap->start[0];
+  x   = BTOR_POP_STACK (*heap);
+  n   = BTOR_COUNT_STACK (*heap);
+  if (n == 0) return res;
+
+  for (i = 0; (c = 2 * i + 1) < n; i = c)
+  {
+    if (c + 1 < n && heap->start[c + 1] < heap->start[c]) c += 1;
+    if (x <= heap->start[c]) break;
+    heap->start[i] = heap->start[c];
+  }
+  heap->start[i] = x;
+  return res;
+}
@@ -0,0 +1,24 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2007-2021 by the authors listed in the AUTHORS file.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#ifndef BTORINTHEAP_H_INCLUDED
+#define BTORINTHEAP_H_INCLUDED
+
+#include "utils/btorstack.h"
+
+/* Binary min-heap of integers, stored in an initialized int stack. Since node
+ * and AIG ids are topologically ordered (children have smaller ids than their
+ * parents), popping ids yields nodes in topological order. */
+
+/* Add 'x' to 'heap'. */
+void btor_intheap_push (BtorIntStack *heap, int32_t x);
+
+/* Remove and return the minimum element of non-empty 'heap'. */
+int32_t btor_intheap_pop (BtorIntStack *heap);
+
+#endif
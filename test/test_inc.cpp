@@ -9,7 +9,10 @@
 #include "test.h"
 
 extern "C" {
+#include "btorcore.h"
 #include "btoropt.h"
+#include "btorslvfun.h"
+#include "btorslvprop.h"
 }
 
 class TestInc : public TestBoolector
@@ -255,3 +258,258 @@ TEST_F (TestInc, lemmas_on_demand1)
   boolector_release_sort (d_btor, s);
   boolector_release_sort (d_btor, as);
 }
+
+TEST_F (TestInc, dual_prop1)
+{
+  int32_t sat_result;
+  BoolectorNode *array, *i, *j, *read1, *read2, *ne, *eq, *ult;
+  BoolectorSort s, as;
+  Btor *clone;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_FUN_DUAL_PROP, 1);
+  s     = boolector_bitvec_sort (d_btor, 8);
+  as    = boolector_array_sort (d_btor, s, s);
+  array = boolector_array (d_btor, as, "array");
+  i     = boolector_var (d_btor, s, "i");
+  j     = boolector_var (d_btor, s, "j");
+  read1 = boolector_read (d_btor, array, i);
+  read2 = boolector_read (d_btor, array, j);
+  ne    = boolector_ne (d_btor, read1, read2);
+  eq    = boolector_eq (d_btor, i, j);
+  ult   = boolector_ult (d_btor, read1, read2);
+  boolector_assert (d_btor, ne);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  boolector_assume (d_btor, eq);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_UNSAT);
+  ASSERT_TRUE (boolector_failed (d_btor, eq));
+  boolector_assert (d_btor, ult);
+  clone      = boolector_clone (d_btor);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  ASSERT_GT (BTOR_FUN_SOLVER (d_btor)->stats.dp_clone_reuses, 0u);
+  ASSERT_GT (BTOR_FUN_SOLVER (d_btor)->stats.dp_clone_constraints, 0u);
+  ASSERT_EQ (boolector_sat (clone), BOOLECTOR_SAT);
+  boolector_delete (clone);
+  boolector_release (d_btor, array);
+  boolector_release (d_btor, i);
+  boolector_release (d_btor, j);
+  boolector_release (d_btor, read1);
+  boolector_release (d_btor, read2);
+  boolector_release (d_btor, ne);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, ult);
+  boolector_release_sort (d_btor, s);
+  boolector_release_sort (d_btor, as);
+}
+
+TEST_F (TestInc, lemma_gc1)
+{
+  int32_t sat_result;
+  BoolectorNode *array, *i, *j, *read1, *read2, *ne, *eq;
+  BoolectorSort s, as;
+  Btor *clone;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_FUN_LEMMA_GC, 1);
+  s     = boolector_bitvec_sort (d_btor, 8);
+  as    = boolector_array_sort (d_btor, s, s);
+  array = boolector_array (d_btor, as, "array");
+  i     = boolector_var (d_btor, s, "i");
+  j     = boolector_var (d_btor, s, "j");
+  read1 = boolector_read (d_btor, array, i);
+  read2 = boolector_read (d_btor, array, j);
+  ne    = boolector_ne (d_btor, read1, read2);
+  eq    = boolector_eq (d_btor, i, j);
+  boolector_assert (d_btor, ne);
+  boolector_assume (d_btor, eq);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_UNSAT);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  ASSERT_GT (BTOR_FUN_SOLVER (d_btor)->stats.lemmas_retired, 0u);
+  clone = boolector_clone (d_btor);
+  boolector_assume (d_btor, eq);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_UNSAT);
+  ASSERT_TRUE (boolector_failed (d_btor, eq));
+  ASSERT_EQ (boolector_sat (clone), BOOLECTOR_SAT);
+  boolector_delete (clone);
+  boolector_release (d_btor, array);
+  boolector_release (d_btor, i);
+  boolector_release (d_btor, j);
+  boolector_release (d_btor, read1);
+  boolector_release (d_btor, read2);
+  boolector_release (d_btor, ne);
+  boolector_release (d_btor, eq);
+  boolector_release_sort (d_btor, s);
+  boolector_release_sort (d_btor, as);
+}
+
+TEST_F (TestInc, fun_threads1)
+{
+  int32_t sat_result;
+  uint32_t k, n = 300;
+  BoolectorNode *array, *read, *val, *eq, *idx[300];
+  BoolectorSort s, as;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_FUN_THREADS, 4);
+  s     = boolector_bitvec_sort (d_btor, 16);
+  as    = boolector_array_sort (d_btor, s, s);
+  array = boolector_array (d_btor, as, "array");
+  for (k = 0; k < n; k++)
+  {
+    idx[k] = boolector_var (d_btor, s, 0);
+    read   = boolector_read (d_btor, array, idx[k]);
+    val    = boolector_unsigned_int (d_btor, k % 4, s);
+    eq     = boolector_eq (d_btor, read, val);
+    boolector_assert (d_btor, eq);
+    boolector_release (d_btor, eq);
+    boolector_release (d_btor, val);
+    boolector_release (d_btor, read);
+  }
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  eq = boolector_eq (d_btor, idx[0], idx[1]);
+  boolector_assume (d_btor, eq);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_UNSAT);
+  ASSERT_TRUE (boolector_failed (d_btor, eq));
+  boolector_release (d_btor, eq);
+  eq = boolector_eq (d_btor, idx[0], idx[4]);
+  boolector_assume (d_btor, eq);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  boolector_release (d_btor, eq);
+  for (k = 0; k < n; k++) boolector_release (d_btor, idx[k]);
+  boolector_release (d_btor, array);
+  boolector_release_sort (d_btor, s);
+  boolector_release_sort (d_btor, as);
+}
+
+TEST_F (TestInc, prop_warm_start1)
+{
+  int32_t sat_result;
+  uint32_t moves;
+  const char *assignment;
+  BoolectorNode *x, *y, *mul, *c, *eq, *val;
+  BoolectorSort s;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_MODEL_GEN, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_ENGINE, BTOR_ENGINE_PROP);
+  boolector_set_opt (d_btor, BTOR_OPT_PROP_WARM_START, 1);
+  s   = boolector_bitvec_sort (d_btor, 16);
+  x   = boolector_var (d_btor, s, "x");
+  y   = boolector_var (d_btor, s, "y");
+  mul = boolector_mul (d_btor, x, y);
+  c   = boolector_unsigned_int (d_btor, 391, s);
+  eq  = boolector_eq (d_btor, mul, c);
+  boolector_assert (d_btor, eq);
+  boolector_release (d_btor, eq);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  /* the model of the previous call satisfies the assumption, no moves */
+  assignment = boolector_bv_assignment (d_btor, x);
+  val        = boolector_const (d_btor, assignment);
+  boolector_free_bv_assignment (d_btor, assignment);
+  eq = boolector_eq (d_btor, x, val);
+  boolector_assume (d_btor, eq);
+  moves      = BTOR_PROP_SOLVER (d_btor)->stats.moves;
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  ASSERT_EQ (BTOR_PROP_SOLVER (d_btor)->stats.moves, moves);
+  boolector_release (d_btor, x);
+  boolector_release (d_btor, y);
+  boolector_release (d_btor, mul);
+  boolector_release (d_btor, c);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, val);
+  boolector_release_sort (d_btor, s);
+}
+
+TEST_F (TestInc, push_pop1)
+{
+  int32_t sat_result;
+  BoolectorNode *x, *y, *eq, *ne;
+  BoolectorSort s;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+  s  = boolector_bitvec_sort (d_btor, 8);
+  x  = boolector_var (d_btor, s, "x");
+  y  = boolector_var (d_btor, s, "y");
+  eq = boolector_eq (d_btor, x, y);
+  ne = boolector_ne (d_btor, x, y);
+  boolector_push (d_btor, 1);
+  boolector_assert (d_btor, eq);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  boolector_push (d_btor, 1);
+  boolector_assert (d_btor, ne);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_UNSAT);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_UNSAT);
+  boolector_pop (d_btor, 2);
+  boolector_assert (d_btor, ne);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  boolector_push (d_btor, 1);
+  boolector_assert (d_btor, eq);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_UNSAT);
+  boolector_pop (d_btor, 1);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  boolector_release (d_btor, x);
+  boolector_release (d_btor, y);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, ne);
+  boolector_release_sort (d_btor, s);
+}
+
+TEST_F (TestInc, ucopt_freeze_out)
+{
+  int32_t sat_result;
+  BoolectorNode *x, *y, *z, *c, *mul, *eq, *ult, *zeq;
+  BoolectorSort s;
+
+  boolector_set_opt (d_btor, BTOR_OPT_INCREMENTAL, 1);
+  boolector_set_opt (d_btor, BTOR_OPT_UCOPT, 1);
+  s   = boolector_bitvec_sort (d_btor, 8);
+  x   = boolector_var (d_btor, s, "x");
+  y   = boolector_var (d_btor, s, "y");
+  z   = boolector_var (d_btor, s, "z");
+  c   = boolector_int (d_btor, 3, s);
+  mul = boolector_mul (d_btor, x, y);
+  eq  = boolector_eq (d_btor, mul, c);
+  ult = boolector_ult (d_btor, z, c);
+  zeq = boolector_eq (d_btor, z, c);
+  boolector_freeze_out (d_btor, x);
+  boolector_freeze_out (d_btor, y);
+  boolector_assert (d_btor, eq);
+  boolector_assert (d_btor, ult);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  ASSERT_GT (d_btor->stats.bv_uc_props, 0u);
+  boolector_assume (d_btor, zeq);
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_UNSAT);
+  ASSERT_TRUE (boolector_failed (d_btor, zeq));
+  sat_result = boolector_sat (d_btor);
+  ASSERT_EQ (sat_result, BOOLECTOR_SAT);
+  boolector_release (d_btor, x);
+  boolector_release (d_btor, y);
+  boolector_release (d_btor, z);
+  boolector_release (d_btor, c);
+  boolector_release (d_btor, mul);
+  boolector_release (d_btor, eq);
+  boolector_release (d_btor, ult);
+  boolector_release (d_btor, zeq);
+  boolector_release_sort (d_btor, s);
+}
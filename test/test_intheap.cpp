@@ -0,0 +1,64 @@
+/*  Boolector: Satisfiability Modulo Theories (SMT) solver.
+ *
+ *  Copyright (C) 2007-2021 by the authors listed in the AUTHORS file.
+ *
+ *  This file is part of Boolector.
+ *  See COPYING for more information on using this software.
+ */
+
+#include "test.h"
+
+extern "C" {
+#include "utils/btorintheap.h"
+}
+
+class TestIntHeap : public TestMm
+{
+};
+
+TEST_F (TestIntHeap, push_pop)
+{
+  BtorIntStack heap;
+  BTOR_INIT_STACK (d_mm, heap);
+
+  btor_intheap_push (&heap, 3);
+  ASSERT_EQ (BTOR_COUNT_STACK (heap), 1u);
+  ASSERT_EQ (btor_intheap_pop (&heap), 3);
+  ASSERT_TRUE (BTOR_EMPTY_STACK (heap));
+
+  btor_intheap_push (&heap, 5);
+  btor_intheap_push (&heap, -2);
+  btor_intheap_push (&heap, 7);
+  btor_intheap_push (&heap, 5);
+  btor_intheap_push (&heap, 0);
+  ASSERT_EQ (BTOR_COUNT_STACK (heap), 5u);
+  ASSERT_EQ (btor_intheap_pop (&heap), -2);
+  ASSERT_EQ (btor_intheap_pop (&heap), 0);
+  btor_intheap_push (&heap, 1);
+  ASSERT_EQ (btor_intheap_pop (&heap), 1);
+  ASSERT_EQ (btor_intheap_pop (&heap), 5);
+  ASSERT_EQ (btor_intheap_pop (&heap), 5);
+  ASSERT_EQ (btor_intheap_pop (&heap), 7);
+  ASSERT_TRUE (BTOR_EMPTY_STACK (heap));
+
+  BTOR_RELEASE_STACK (heap);
+}
+
+TEST_F (TestIntHeap, sorted)
+{
+  int32_t i, x, prev;
+  BtorIntStack heap;
+  BTOR_INIT_STACK (d_mm, heap);
+
+  for (i = 0; i < 1000; i++) btor_intheap_push (&heap, (i * 7919) % 1009);
+  ASSERT_EQ (BTOR_COUNT_STACK (heap), 1000u);
+  prev = btor_intheap_pop (&heap);
+  while (!BTOR_EMPTY_STACK (heap))
+  {
+    x = btor_intheap_pop (&heap);
+    ASSERT_LE (prev, x);
+    prev = x;
+  }
+
+  BTOR_RELEASE_STACK (heap);
+}
@@ -423,3 +423,117 @@ TEST_F (TestProp, complete_slice)
   btor_sort_release (d_btor, sort);
 #endif
 }
+
+TEST_F (TestProp, parallel_walkers)
+{
+  BtorSortId sort;
+  BtorNode *x, *y, *one, *mul, *c, *eq, *ugtx, *ugty;
+  int32_t res;
+  const BtorBitVector *bvx, *bvy;
+  BtorBitVector *prod;
+
+  btor_opt_set (d_btor, BTOR_OPT_PROP_THREADS, 4);
+  btor_opt_set (d_btor, BTOR_OPT_PROP_PROB_USE_INV_VALUE, 990);
+  btor_opt_set (d_btor, BTOR_OPT_MODEL_GEN, 1);
+
+  sort = btor_sort_bv (d_btor, 8);
+  x    = btor_exp_var (d_btor, sort, "x");
+  y    = btor_exp_var (d_btor, sort, "y");
+  one  = btor_exp_bv_one (d_btor, sort);
+  c    = btor_exp_bv_unsigned (d_btor, 42, sort);
+  btor_sort_release (d_btor, sort);
+  mul  = btor_exp_bv_mul (d_btor, x, y);
+  eq   = btor_exp_eq (d_btor, mul, c);
+  ugtx = btor_exp_bv_ugt (d_btor, x, one);
+  ugty = btor_exp_bv_ugt (d_btor, y, one);
+  btor_assert_exp (d_btor, eq);
+  btor_assert_exp (d_btor, ugtx);
+  btor_assert_exp (d_btor, ugty);
+
+  res = btor_check_sat (d_btor, -1, -1);
+  ASSERT_EQ (res, BTOR_RESULT_SAT);
+  bvx  = btor_model_get_bv (d_btor, x);
+  bvy  = btor_model_get_bv (d_btor, y);
+  prod = btor_bv_mul (d_mm, bvx, bvy);
+  ASSERT_EQ (btor_bv_to_uint64 (prod), 42u);
+  ASSERT_GT (btor_bv_to_uint64 (bvx), 1u);
+  ASSERT_GT (btor_bv_to_uint64 (bvy), 1u);
+
+  btor_bv_free (d_mm, prod);
+  btor_node_release (d_btor, ugty);
+  btor_node_release (d_btor, ugtx);
+  btor_node_release (d_btor, eq);
+  btor_node_release (d_btor, mul);
+  btor_node_release (d_btor, c);
+  btor_node_release (d_btor, one);
+  btor_node_release (d_btor, y);
+  btor_node_release (d_btor, x);
+}
+
+#ifndef NDEBUG
+TEST_F (TestProp, inv_cache)
+{
+  BtorSortId sort;
+  BtorNode *x, *y, *mul, *udiv;
+  BtorBitVector *bvmul, *bve, *res1, *res2;
+  BtorPropSolver *slv;
+
+  slv = BTOR_PROP_SOLVER (d_btor);
+
+  sort = btor_sort_bv (d_btor, 16);
+  x    = btor_exp_var (d_btor, sort, 0);
+  y    = btor_exp_var (d_btor, sort, 0);
+  btor_sort_release (d_btor, sort);
+  mul  = btor_exp_bv_mul (d_btor, x, y);
+  udiv = btor_exp_bv_udiv (d_btor, x, y);
+
+  /* bve odd: unique solution, cached after the first computation */
+  bvmul = btor_bv_uint64_to_bv (d_mm, 1234, 16);
+  bve   = btor_bv_uint64_to_bv (d_mm, 77, 16);
+  res1  = inv_mul_bv (d_btor, mul, bvmul, bve, 1);
+  ASSERT_EQ (slv->stats.inv_cache_hits, 0u);
+  ASSERT_EQ (slv->stats.inv_cache_misses, 1u);
+  res2 = inv_mul_bv (d_btor, mul, bvmul, bve, 1);
+  ASSERT_EQ (slv->stats.inv_cache_hits, 1u);
+  ASSERT_EQ (btor_bv_compare (res1, res2), 0);
+  btor_bv_free (d_mm, res1);
+  btor_bv_free (d_mm, res2);
+  /* operand index is part of the key */
+  res1 = inv_mul_bv (d_btor, mul, bvmul, bve, 0);
+  ASSERT_EQ (slv->stats.inv_cache_misses, 2u);
+  btor_bv_free (d_mm, res1);
+  btor_bv_free (d_mm, bvmul);
+  btor_bv_free (d_mm, bve);
+
+  /* e[0] / 7 = 100: cached bounds, random value within bounds */
+  bvmul = btor_bv_uint64_to_bv (d_mm, 100, 16);
+  bve   = btor_bv_uint64_to_bv (d_mm, 7, 16);
+  for (uint32_t i = 0; i < 20; i++)
+  {
+    res1 = inv_udiv_bv (d_btor, udiv, bvmul, bve, 0);
+    ASSERT_GE (btor_bv_to_uint64 (res1), 700u);
+    ASSERT_LE (btor_bv_to_uint64 (res1), 706u);
+    btor_bv_free (d_mm, res1);
+  }
+  ASSERT_GT (slv->stats.inv_cache_hits, 1u);
+  btor_bv_free (d_mm, bvmul);
+  btor_bv_free (d_mm, bve);
+
+  /* cache disabled */
+  btor_opt_set (d_btor, BTOR_OPT_PROP_INV_CACHE, 0);
+  bvmul = btor_bv_uint64_to_bv (d_mm, 1234, 16);
+  bve   = btor_bv_uint64_to_bv (d_mm, 77, 16);
+  res1  = inv_mul_bv (d_btor, mul, bvmul, bve, 1);
+  res2  = inv_mul_bv (d_btor, mul, bvmul, bve, 1);
+  ASSERT_EQ (btor_bv_compare (res1, res2), 0);
+  btor_bv_free (d_mm, res1);
+  btor_bv_free (d_mm, res2);
+  btor_bv_free (d_mm, bvmul);
+  btor_bv_free (d_mm, bve);
+
+  btor_node_release (d_btor, udiv);
+  btor_node_release (d_btor, mul);
+  btor_node_release (d_btor, y);
+  btor_node_release (d_btor, x);
+}
+#endif
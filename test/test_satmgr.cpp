@@ -40,3 +40,75 @@ TEST_F (TestSatMgr, next_cnf_id)
   ASSERT_EQ (btor_sat_mgr_next_cnf_id (d_smgr), 4);
   btor_sat_reset (d_smgr);
 }
+
+TEST_F (TestSatMgr, clause_buffer)
+{
+  int32_t a, b;
+
+  btor_sat_enable_solver (d_smgr);
+  btor_sat_init (d_smgr);
+  a = btor_sat_mgr_next_cnf_id (d_smgr);
+  b = btor_sat_mgr_next_cnf_id (d_smgr);
+  btor_sat_add (d_smgr, a);
+  btor_sat_add (d_smgr, b);
+  btor_sat_add (d_smgr, 0);
+  btor_sat_add (d_smgr, -a);
+  btor_sat_add (d_smgr, 0);
+  ASSERT_FALSE (BTOR_EMPTY_STACK (d_smgr->clause_buffer));
+  btor_sat_flush_clauses (d_smgr);
+  ASSERT_TRUE (BTOR_EMPTY_STACK (d_smgr->clause_buffer));
+  btor_sat_add (d_smgr, -b);
+  btor_sat_add (d_smgr, 0);
+  ASSERT_EQ (btor_sat_check_sat (d_smgr, -1), BTOR_RESULT_UNSAT);
+  ASSERT_TRUE (BTOR_EMPTY_STACK (d_smgr->clause_buffer));
+  ASSERT_EQ (d_smgr->clauses, 4);
+  btor_sat_reset (d_smgr);
+}
+
+TEST_F (TestSatMgr, call_stats)
+{
+  int32_t a;
+  const BtorSATCallStats *c;
+
+  btor_opt_set (d_btor, BTOR_OPT_SAT_CALL_STATS, 2);
+  btor_sat_enable_solver (d_smgr);
+  btor_sat_init (d_smgr);
+  a = btor_sat_mgr_next_cnf_id (d_smgr);
+  btor_sat_add (d_smgr, a);
+  btor_sat_add (d_smgr, 0);
+  ASSERT_EQ (btor_sat_check_sat (d_smgr, -1), BTOR_RESULT_SAT);
+  ASSERT_EQ (btor_sat_num_call_stats (d_smgr), 1u);
+  ASSERT_EQ (btor_sat_check_sat (d_smgr, -1), BTOR_RESULT_SAT);
+  btor_sat_assume (d_smgr, -a);
+  ASSERT_EQ (btor_sat_check_sat (d_smgr, -1), BTOR_RESULT_UNSAT);
+  ASSERT_EQ (btor_sat_num_call_stats (d_smgr), 2u);
+  c = btor_sat_get_call_stats (d_smgr, 0);
+  ASSERT_EQ (c->call, 2);
+  ASSERT_EQ (c->new_clauses, 0);
+  ASSERT_EQ (c->assumptions, 0);
+  c = btor_sat_get_call_stats (d_smgr, 1);
+  ASSERT_EQ (c->call, 3);
+  ASSERT_EQ (c->result, BTOR_RESULT_UNSAT);
+  ASSERT_EQ (c->assumptions, 1);
+  btor_sat_reset (d_smgr);
+}
+
+TEST_F (TestSatMgr, phase)
+{
+  int32_t a, b;
+
+  btor_sat_enable_solver (d_smgr);
+  btor_sat_init (d_smgr);
+  if (!d_smgr->api.phase) return;
+  a = btor_sat_mgr_next_cnf_id (d_smgr);
+  b = btor_sat_mgr_next_cnf_id (d_smgr);
+  btor_sat_add (d_smgr, a);
+  btor_sat_add (d_smgr, b);
+  btor_sat_add (d_smgr, 0);
+  btor_sat_phase (d_smgr, -a);
+  btor_sat_phase (d_smgr, b);
+  ASSERT_EQ (btor_sat_check_sat (d_smgr, -1), BTOR_RESULT_SAT);
+  ASSERT_EQ (btor_sat_deref (d_smgr, a), -1);
+  ASSERT_EQ (btor_sat_deref (d_smgr, b), 1);
+  btor_sat_reset (d_smgr);
+}